@@ -1,6 +1,7 @@
 #include "Assert.h"
 
 #include <stdbool.h>
+#include <stdlib.h>
 
 #include "Atomic.h"
 #include "Log.h"
@@ -10,6 +11,13 @@ void Assert_Callback(uint32_t pc)
     // Enter critical section and never exit
     Atomic_CriticalEnter();
 
+#ifdef POSIX_HOST
+    LOG_E("ASSERT ERROR");
+    LOG_FLUSH();
+    UNUSED(pc);
+
+    abort();
+#else
     while (true)
     {
         LOG_FLUSH();
@@ -27,4 +35,5 @@ void Assert_Callback(uint32_t pc)
             // Do nothing
         }
     }
+#endif
 }
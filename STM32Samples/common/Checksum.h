@@ -4,6 +4,30 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// CRC engines - trade Flash memory for speed
+#define CHECKSUM_CRC_ENGINE_BITWISE 0        // No lookup table, 8 iterations per byte
+#define CHECKSUM_CRC_ENGINE_NIBBLE_TABLE 1   // 16 entries lookup table, 2 iterations per byte
+#define CHECKSUM_CRC_ENGINE_BYTE_TABLE 2     // 256 entries lookup table, 1 iteration per byte
+#define CHECKSUM_CRC_ENGINE_SLICE_BY_4 3     // 4 x 256 entries lookup tables, 1 iteration per 4 bytes (CRC32 only)
+
+#ifndef CHECKSUM_CRC16_ENGINE
+#define CHECKSUM_CRC16_ENGINE CHECKSUM_CRC_ENGINE_BYTE_TABLE
+#endif
+
+#ifndef CHECKSUM_CRC32_ENGINE
+#define CHECKSUM_CRC32_ENGINE CHECKSUM_CRC_ENGINE_BYTE_TABLE
+#endif
+
+#define CHECKSUM_SHA256_SIZE 32
+#define CHECKSUM_SHA256_CHUNK_SIZE 64
+
+struct ChecksumSHA256Context
+{
+    uint32_t hash[CHECKSUM_SHA256_SIZE / sizeof(uint32_t)];
+    uint8_t  chunk[CHECKSUM_SHA256_CHUNK_SIZE];
+    size_t   chunk_len;
+    uint64_t total_len;
+};
 
 /*
  *  Calculate CRC16
@@ -15,6 +39,15 @@
  */
 uint16_t Checksum_CalcCRC16(uint8_t *p_data, size_t len, uint16_t init_val);
 
+/*
+ *  Update CRC16 with a single byte
+ *
+ *  @param data         Data byte
+ *  @param crc          Current CRC value
+ *  @return             Updated CRC
+ */
+uint16_t Checksum_UpdateCRC16(uint8_t data, uint16_t crc);
+
 /*
  *  Calculate CRC32
  *
@@ -34,4 +67,28 @@ uint32_t Checksum_CalcCRC32(uint8_t *p_data, size_t len, uint32_t init_val);
  */
 void Checksum_CalcSHA256(uint8_t *p_data, size_t len, uint8_t *p_sha256);
 
+/*
+ *  Start incremental SHA256 calculation
+ *
+ *  @param p_ctx        Pointer to SHA256 context
+ */
+void Checksum_InitSHA256(struct ChecksumSHA256Context *p_ctx);
+
+/*
+ *  Add data to incremental SHA256 calculation
+ *
+ *  @param p_ctx        Pointer to SHA256 context
+ *  @param p_data       Pointer to data
+ *  @param len          Data len
+ */
+void Checksum_UpdateSHA256(struct ChecksumSHA256Context *p_ctx, uint8_t *p_data, size_t len);
+
+/*
+ *  Finish incremental SHA256 calculation. Context has to be initialized again before next use.
+ *
+ *  @param p_ctx        Pointer to SHA256 context
+ *  @param p_sha256     [out] calculated SHA256
+ */
+void Checksum_FinalSHA256(struct ChecksumSHA256Context *p_ctx, uint8_t *p_sha256);
+
 #endif
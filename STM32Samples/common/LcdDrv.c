@@ -5,6 +5,7 @@
 #include "Assert.h"
 #include "I2cHal.h"
 #include "Log.h"
+#include "Startup.h"
 #include "Timestamp.h"
 #include "Utils.h"
 
@@ -73,7 +74,17 @@ static bool    IsInitialized     = false;
 
 static void LcdDrv_SetBacklight(bool on);
 
-static void LcdDrv_LcdInit(void);
+static bool LcdDrv_StartupPowerOn(void);
+
+static bool LcdDrv_StartupSet8BitMode(void);
+
+static bool LcdDrv_StartupSet4BitMode(void);
+
+static bool LcdDrv_StartupFunctionSet(void);
+
+static bool LcdDrv_StartupDisplayOn(void);
+
+static bool LcdDrv_StartupDone(void);
 
 static void LcdDrv_SetOutputPortValue(uint8_t port_value);
 
@@ -83,6 +94,34 @@ static void LcdDrv_Write4bits(uint8_t value, uint8_t mode);
 
 static void LcdDrv_PulseEnable(uint8_t data);
 
+// HD44780 initialization by instruction, each step waits for the execution time of the instruction
+static const struct StartupStep StartupSteps[] = {
+    // Display startup time minimum 50ms
+    {LcdDrv_StartupPowerOn, 50},
+
+    // Set 8 bit mode three times, special case of "Function Set", wait min 4.1ms after the first try
+    {LcdDrv_StartupSet8BitMode, 5},
+    {LcdDrv_StartupSet8BitMode, 1},
+    {LcdDrv_StartupSet8BitMode, 1},
+
+    // Set to 4-bit interface, wait min of 100us
+    {LcdDrv_StartupSet4BitMode, 1},
+
+    // Set lines, font size, etc.
+    {LcdDrv_StartupFunctionSet, 1},
+
+    // Clear display command is time consuming
+    {LcdDrv_StartupDisplayOn, 3},
+
+    {LcdDrv_StartupDone, 0},
+};
+
+static const struct StartupSequence StartupSequence = {
+    .p_name    = "LcdDrv",
+    .p_steps   = StartupSteps,
+    .steps_cnt = ARRAY_SIZE(StartupSteps),
+};
+
 void LcdDrv_Init(void)
 {
     ASSERT(!IsInitialized);
@@ -99,12 +138,8 @@ void LcdDrv_Init(void)
         return;
     }
 
-    LcdDrv_SetBacklight(true);
-    LcdDrv_LcdInit();
-
-    LcdDrv_SetCursor(0, 0);
-
-    IsInitialized = true;
+    // Display is initialized when the startup is done
+    Startup_AddSequence(&StartupSequence);
 }
 
 bool LcdDrv_IsInitialized(void)
@@ -173,44 +208,55 @@ static void LcdDrv_SetBacklight(bool on)
     LcdDrv_SetOutputPortValue(IsBacklightOnMask);
 }
 
-static void LcdDrv_LcdInit(void)
+static bool LcdDrv_StartupPowerOn(void)
 {
-    // Display startup time minimum 50ms
-    Timestamp_DelayMs(50);
+    LcdDrv_SetBacklight(true);
 
-    // Set 4 bit mode, Special case of "Function Set"
-    LcdDrv_LcdSend(0x03, LCD_DRV_FOUR_BITS);
-    // Wait min 4.1ms
-    Timestamp_DelayMs(5);
+    return true;
+}
 
-    // Second try
+static bool LcdDrv_StartupSet8BitMode(void)
+{
     LcdDrv_LcdSend(0x03, LCD_DRV_FOUR_BITS);
-    // Wait min 100us
-    Timestamp_DelayMs(1);
 
-    // Third try
-    LcdDrv_LcdSend(0x03, LCD_DRV_FOUR_BITS);
-    // Wait min of 100us
-    Timestamp_DelayMs(1);
+    return true;
+}
 
-    // Set to 4-bit interface
+static bool LcdDrv_StartupSet4BitMode(void)
+{
     LcdDrv_LcdSend(0x02, LCD_DRV_FOUR_BITS);
-    // Wait min of 100us
-    Timestamp_DelayMs(1);
 
-    // Set lines, font size, etc.
+    return true;
+}
+
+static bool LcdDrv_StartupFunctionSet(void)
+{
     LcdDrv_LcdSend(LCD_DRV_FUNCTIONSET | LCD_DRV_4BITMODE | LCD_DRV_2LINE | LCD_DRV_5x8DOTS, LCD_DRV_COMMAND);
-    // Wait 1ms
-    Timestamp_DelayMs(1);
 
+    return true;
+}
+
+static bool LcdDrv_StartupDisplayOn(void)
+{
     // Turn the display on with no cursor or blinking default
     LcdDrv_LcdSend(LCD_DRV_DISPLAYCONTROL | LCD_DRV_DISPLAYON | LCD_DRV_CURSOROFF | LCD_DRV_BLINKOFF, LCD_DRV_COMMAND);
 
     // Clear the LCD
-    LcdDrv_Clear();
+    LcdDrv_LcdSend(LCD_DRV_CLEARDISPLAY, LCD_DRV_COMMAND);
 
+    return true;
+}
+
+static bool LcdDrv_StartupDone(void)
+{
     // Initialize to default text direction (for romance languages), set the entry mode
     LcdDrv_LcdSend(LCD_DRV_ENTRYMODESET | LCD_DRV_ENTRYLEFT | LCD_DRV_ENTRYSHIFTDECREMENT, LCD_DRV_COMMAND);
+
+    IsInitialized = true;
+
+    LcdDrv_SetCursor(0, 0);
+
+    return true;
 }
 
 static void LcdDrv_SetOutputPortValue(uint8_t port_value)
@@ -95,10 +95,10 @@ struct EnqueuedMsg
 
 struct EnqueuedMsg *MeshMsgsQueue[MESH_MESSAGES_QUEUE_LENGTH];
 
-static void    SendGenericOnOffSet(uint8_t instance_idx, struct GenericOnOffSetMsg *message);
-static void    SendLightLSet(uint8_t instance_idx, struct LightLSetMsg *message);
-static void    SendGenericLevelSet(uint8_t instance_idx, struct GenericLevelSetMsg *message);
-static void    SendGenericDeltaSet(uint8_t instance_idx, struct GenericDeltaSetMsg *message);
+static bool    SendGenericOnOffSet(uint8_t instance_idx, struct GenericOnOffSetMsg *message);
+static bool    SendLightLSet(uint8_t instance_idx, struct LightLSetMsg *message);
+static bool    SendGenericLevelSet(uint8_t instance_idx, struct GenericLevelSetMsg *message);
+static bool    SendGenericDeltaSet(uint8_t instance_idx, struct GenericDeltaSetMsg *message);
 static uint8_t ConvertFromMsToMeshFormat(uint32_t time_ms);
 
 static void Mesh_Loop(void);
@@ -282,7 +282,7 @@ void Mesh_IncrementTid(uint8_t *p_tid)
     *p_tid = *p_tid + 1;
 }
 
-static void SendGenericOnOffSet(uint8_t instance_idx, struct GenericOnOffSetMsg *message)
+static bool SendGenericOnOffSet(uint8_t instance_idx, struct GenericOnOffSetMsg *message)
 {
     uint8_t buf[MESH_MESSAGE_GENERIC_ONOFF_SET_LEN];
     size_t  index = 0;
@@ -296,10 +296,10 @@ static void SendGenericOnOffSet(uint8_t instance_idx, struct GenericOnOffSetMsg
     buf[index++] = message->transition_time;
     buf[index++] = message->delay;
 
-    UartProtocol_Send(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
+    return UartProtocol_TrySend(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
 }
 
-static void SendLightLSet(uint8_t instance_idx, struct LightLSetMsg *message)
+static bool SendLightLSet(uint8_t instance_idx, struct LightLSetMsg *message)
 {
     uint8_t buf[MESH_MESSAGE_LIGHT_L_SET_LEN];
     size_t  index = 0;
@@ -314,10 +314,10 @@ static void SendLightLSet(uint8_t instance_idx, struct LightLSetMsg *message)
     buf[index++] = message->transition_time;
     buf[index++] = message->delay;
 
-    UartProtocol_Send(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
+    return UartProtocol_TrySend(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
 }
 
-static void SendGenericLevelSet(uint8_t instance_idx, struct GenericLevelSetMsg *message)
+static bool SendGenericLevelSet(uint8_t instance_idx, struct GenericLevelSetMsg *message)
 {
     uint8_t buf[MESH_MESSAGE_GENERIC_LEVEL_SET_LEN];
     size_t  index = 0;
@@ -332,10 +332,10 @@ static void SendGenericLevelSet(uint8_t instance_idx, struct GenericLevelSetMsg
     buf[index++] = message->transition_time;
     buf[index++] = message->delay;
 
-    UartProtocol_Send(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
+    return UartProtocol_TrySend(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
 }
 
-static void SendGenericDeltaSet(uint8_t instance_idx, struct GenericDeltaSetMsg *message)
+static bool SendGenericDeltaSet(uint8_t instance_idx, struct GenericDeltaSetMsg *message)
 {
     uint8_t buf[MESH_MESSAGE_GENERIC_DELTA_SET_LEN];
     size_t  index = 0;
@@ -352,7 +352,7 @@ static void SendGenericDeltaSet(uint8_t instance_idx, struct GenericDeltaSetMsg
     buf[index++] = message->transition_time;
     buf[index++] = message->delay;
 
-    UartProtocol_Send(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
+    return UartProtocol_TrySend(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, buf, sizeof(buf));
 }
 
 static uint8_t ConvertFromMsToMeshFormat(uint32_t time_ms)
@@ -390,42 +390,33 @@ static void Mesh_Loop(void)
         if (Timestamp_Compare(Timestamp_GetCurrent(), MeshMsgsQueue[i]->dispatch_time))
             continue;
 
+        bool is_sent;
         switch (MeshMsgsQueue[i]->msg_type)
         {
             case GENERIC_ON_OFF_SET_MSG:
-            {
-                SendGenericOnOffSet(MeshMsgsQueue[i]->instance_idx, (struct GenericOnOffSetMsg *)MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]);
-                MeshMsgsQueue[i] = NULL;
+                is_sent = SendGenericOnOffSet(MeshMsgsQueue[i]->instance_idx, (struct GenericOnOffSetMsg *)MeshMsgsQueue[i]->mesh_msg);
                 break;
-            }
             case GENERIC_DELTA_SET_MSG:
-            {
-                SendGenericDeltaSet(MeshMsgsQueue[i]->instance_idx, (struct GenericDeltaSetMsg *)MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]);
-                MeshMsgsQueue[i] = NULL;
+                is_sent = SendGenericDeltaSet(MeshMsgsQueue[i]->instance_idx, (struct GenericDeltaSetMsg *)MeshMsgsQueue[i]->mesh_msg);
                 break;
-            }
             case LIGHT_L_SET_MSG:
-            {
-                SendLightLSet(MeshMsgsQueue[i]->instance_idx, (struct LightLSetMsg *)MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]);
-                MeshMsgsQueue[i] = NULL;
+                is_sent = SendLightLSet(MeshMsgsQueue[i]->instance_idx, (struct LightLSetMsg *)MeshMsgsQueue[i]->mesh_msg);
                 break;
-            }
             case GENERIC_LEVEL_SET_MSG:
-            {
-                SendGenericLevelSet(MeshMsgsQueue[i]->instance_idx, (struct GenericLevelSetMsg *)MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]->mesh_msg);
-                free(MeshMsgsQueue[i]);
-                MeshMsgsQueue[i] = NULL;
+                is_sent = SendGenericLevelSet(MeshMsgsQueue[i]->instance_idx, (struct GenericLevelSetMsg *)MeshMsgsQueue[i]->mesh_msg);
                 break;
-            }
             default:
-                break;
+                continue;
+        }
+
+        if (!is_sent)
+        {
+            // TX buffer is full, the rest of the queue is sent in the next round
+            return;
         }
+
+        free(MeshMsgsQueue[i]->mesh_msg);
+        free(MeshMsgsQueue[i]);
+        MeshMsgsQueue[i] = NULL;
     }
 }
\ No newline at end of file
@@ -74,7 +74,7 @@ void ModelManager_SetInstanceIndex(uint16_t model_id, uint8_t instance_index)
 
         if ((ModelsList[i]->model_id == model_id) && (ModelsList[i]->p_instance_index != NULL))
         {
-            LOG_D("Instance index of: %u set for model id: 0x%04X at position: %u", instance_index, model_id, i);
+            LOG_D("Instance index of: %u set for model id: 0x%04X at position: %u", instance_index, model_id, (unsigned int)i);
 
             *ModelsList[i]->p_instance_index = instance_index;
             return;
@@ -19,6 +19,10 @@
 #include "UartFrame.h"
 #include "UartProtocol.h"
 
+#define MODEM_FIRMWARE_VERSION_TIMEOUT_MS 500
+#define MODEM_FIRMWARE_VERSION_RETRIES_CNT 2
+#define MODEM_STATE_CHANGE_TIMEOUT_MS 1000
+
 static void EnableTasks(bool enable);
 static void ProcessEnterInitDevice(struct UartFrameRxTxFrame *p_frame);
 static void ProcessEnterDevice(uint8_t *p_payload, uint8_t len);
@@ -28,6 +32,7 @@ static void ProcessError(uint8_t *p_payload, uint8_t len);
 static void ProcessModemFirmwareVersion(uint8_t *p_payload, uint8_t len);
 static void SendFirmwareVersionSetRequest(void);
 static void UartMessageHandler(struct UartFrameRxTxFrame *p_frame);
+static void ProcessRequestTimeout(enum UartFrameCmd cmd, uint8_t instance_index);
 
 static const enum UartFrameCmd UartFrameCommandList[] = {
     UART_FRAME_CMD_INIT_DEVICE_EVENT,
@@ -50,6 +55,31 @@ static struct UartProtocolHandlerConfig MessageHandlerConfig = {
     .instance_index               = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
 };
 
+// Responses are processed by the message handler, requests changing the modem state are not retried
+static const struct UartProtocolRequestConfig CreateInstancesRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_CREATE_INSTANCES_RESPONSE,
+    .timeout_ms          = MODEM_STATE_CHANGE_TIMEOUT_MS,
+    .retries_cnt         = 0,
+};
+
+static const struct UartProtocolRequestConfig StartNodeRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_START_NODE_RESPONSE,
+    .timeout_ms          = MODEM_STATE_CHANGE_TIMEOUT_MS,
+    .retries_cnt         = 0,
+};
+
+static const struct UartProtocolRequestConfig ModemFirmwareVersionRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_RESPONSE,
+    .timeout_ms          = MODEM_FIRMWARE_VERSION_TIMEOUT_MS,
+    .retries_cnt         = MODEM_FIRMWARE_VERSION_RETRIES_CNT,
+};
+
 static enum ModemState ModemState    = MODEM_STATE_UNKNOWN;
 static bool            IsInitialized = false;
 
@@ -102,8 +132,8 @@ static void ProcessEnterInitDevice(struct UartFrameRxTxFrame *p_frame)
     }
 
     SendFirmwareVersionSetRequest();
-    UartProtocol_Send(UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_REQUEST, NULL, 0);
-    UartProtocol_Send(UART_FRAME_CMD_CREATE_INSTANCES_REQUEST, model_ids, index);
+    UartProtocol_SendRequest(&ModemFirmwareVersionRequestConfig, UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_REQUEST, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN, NULL, 0);
+    UartProtocol_SendRequest(&CreateInstancesRequestConfig, UART_FRAME_CMD_CREATE_INSTANCES_REQUEST, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN, model_ids, index);
 }
 
 static void ProcessEnterDevice(uint8_t *p_payload, uint8_t len)
@@ -146,8 +176,8 @@ static void ProcessEnterInitNode(uint8_t *p_payload, uint8_t len)
     ModelManager_IsAllModelsRegistered();
 
     SendFirmwareVersionSetRequest();
-    UartProtocol_Send(UART_FRAME_CMD_START_NODE_REQUEST, NULL, 0);
-    UartProtocol_Send(UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_REQUEST, NULL, 0);
+    UartProtocol_SendRequest(&StartNodeRequestConfig, UART_FRAME_CMD_START_NODE_REQUEST, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN, NULL, 0);
+    UartProtocol_SendRequest(&ModemFirmwareVersionRequestConfig, UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_REQUEST, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN, NULL, 0);
 }
 
 static void ProcessEnterNode(uint8_t *p_payload, uint8_t len)
@@ -182,6 +212,13 @@ static void SendFirmwareVersionSetRequest(void)
     UartProtocol_Send(UART_FRAME_CMD_FIRMWARE_VERSION_SET_REQ, (uint8_t *)p_firmware_version, strlen(p_firmware_version));
 }
 
+static void ProcessRequestTimeout(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    LOG_W("Request 0x%02X not answered in modem state %d", cmd, ModemState);
+
+    UNUSED(instance_index);
+}
+
 static void UartMessageHandler(struct UartFrameRxTxFrame *p_frame)
 {
     ASSERT(p_frame != NULL);
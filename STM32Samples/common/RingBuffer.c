@@ -6,6 +6,17 @@
 
 #include "Assert.h"
 
+// Index written by one side is published with release and read by the other side with acquire ordering,
+// so data in the buffer and the skipped tail are always written before the index is seen
+#define RING_BUFFER_LOAD_INDEX(p_index) __atomic_load_n(p_index, __ATOMIC_ACQUIRE)
+#define RING_BUFFER_STORE_INDEX(p_index, value) __atomic_store_n(p_index, value, __ATOMIC_RELEASE)
+
+static size_t   ReadIndex(struct RingBuffer *p_ring_buffer, size_t wr);
+static size_t   FreeLen(struct RingBuffer *p_ring_buffer);
+static uint16_t ReadSpans(struct RingBuffer *p_ring_buffer, size_t wr, size_t rd, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT]);
+static size_t   AdvanceReadIndex(struct RingBuffer *p_ring_buffer, size_t wr, size_t rd, uint16_t len);
+static uint16_t CopySpans(struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT], uint8_t *p_dst, uint16_t len);
+static void     PublishWrIndex(struct RingBuffer *p_ring_buffer, size_t wr);
 static bool     IsOverflow(struct RingBuffer *p_ring_buffer, uint16_t len);
 static uint16_t MaxQueueBufferLen(struct RingBuffer *p_ring_buffer, uint16_t table_len);
 
@@ -13,47 +24,141 @@ void RingBuffer_Init(struct RingBuffer *p_ring_buffer, uint8_t *p_buf_pointer, s
 {
     ASSERT((p_ring_buffer != NULL) && (p_buf_pointer != NULL));
 
+    // Indices are wrapped around with a mask
+    ASSERT((buf_len != 0) && ((buf_len & (buf_len - 1)) == 0));
+
     p_ring_buffer->p_buf   = p_buf_pointer;
     p_ring_buffer->buf_len = buf_len;
+    p_ring_buffer->mask    = buf_len - 1;
     p_ring_buffer->wr      = 0;
     p_ring_buffer->rd      = 0;
+    p_ring_buffer->end     = buf_len;
 }
 
 bool RingBuffer_IsEmpty(struct RingBuffer *p_ring_buffer)
 {
     ASSERT(p_ring_buffer != NULL);
 
-    return p_ring_buffer->wr == p_ring_buffer->rd;
+    return RING_BUFFER_LOAD_INDEX(&p_ring_buffer->wr) == RING_BUFFER_LOAD_INDEX(&p_ring_buffer->rd);
 }
 
-void RingBuffer_SetWrIndex(struct RingBuffer *p_ring_buffer, uint16_t value)
+void RingBuffer_IncrementRdIndex(struct RingBuffer *p_ring_buffer, uint16_t value)
 {
     ASSERT(p_ring_buffer != NULL);
 
-    p_ring_buffer->wr = (value) % p_ring_buffer->buf_len;
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    size_t wr = RING_BUFFER_LOAD_INDEX(&p_ring_buffer->wr);
+    size_t rd = ReadIndex(p_ring_buffer, wr);
+
+    ASSERT(value <= ReadSpans(p_ring_buffer, wr, rd, spans));
+
+    RING_BUFFER_STORE_INDEX(&p_ring_buffer->rd, AdvanceReadIndex(p_ring_buffer, wr, rd, value));
 }
 
-void RingBuffer_IncrementRdIndex(struct RingBuffer *p_ring_buffer, uint16_t value)
+bool RingBuffer_Reserve(struct RingBuffer *p_ring_buffer, uint16_t len, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT])
+{
+    ASSERT((p_ring_buffer != NULL) && (p_spans != NULL));
+
+    if (IsOverflow(p_ring_buffer, len))
+    {
+        return false;
+    }
+
+    uint16_t first_span_len = MaxQueueBufferLen(p_ring_buffer, len);
+
+    p_spans[0].p_buf = &p_ring_buffer->p_buf[p_ring_buffer->wr & p_ring_buffer->mask];
+    p_spans[0].len   = first_span_len;
+    p_spans[1].p_buf = p_ring_buffer->p_buf;
+    p_spans[1].len   = len - first_span_len;
+
+    return true;
+}
+
+bool RingBuffer_ReserveContinuous(struct RingBuffer *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_span != NULL));
+
+    size_t offset   = p_ring_buffer->wr & p_ring_buffer->mask;
+    size_t tail_len = p_ring_buffer->buf_len - offset;
+    size_t free_len = FreeLen(p_ring_buffer);
+
+    if ((len <= tail_len) && (len <= free_len))
+    {
+        p_span->p_buf = &p_ring_buffer->p_buf[offset];
+    }
+    else if ((len <= p_ring_buffer->buf_len) && ((tail_len + len <= free_len) || (free_len == p_ring_buffer->buf_len)))
+    {
+        // Tail is skipped, the whole empty buffer is available as nothing is read from the skipped tail
+        p_span->p_buf = p_ring_buffer->p_buf;
+    }
+    else
+    {
+        return false;
+    }
+
+    p_span->len = len;
+
+    return true;
+}
+
+void RingBuffer_CommitContinuous(struct RingBuffer *p_ring_buffer, struct RingBufferSpan *p_span)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_span != NULL));
+
+    size_t wr     = p_ring_buffer->wr;
+    size_t offset = wr & p_ring_buffer->mask;
+
+    if (p_span->p_buf != &p_ring_buffer->p_buf[offset])
+    {
+        // Record did not fit before the end of the buffer, it starts with the next wrap around
+        p_ring_buffer->end = offset;
+        RING_BUFFER_STORE_INDEX(&p_ring_buffer->wr, (wr | p_ring_buffer->mask) + 1 + p_span->len);
+        return;
+    }
+
+    PublishWrIndex(p_ring_buffer, wr + p_span->len);
+}
+
+uint16_t RingBuffer_GetMaxContinuousFreeLen(struct RingBuffer *p_ring_buffer)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    size_t tail_len = p_ring_buffer->buf_len - (p_ring_buffer->wr & p_ring_buffer->mask);
+    size_t free_len = FreeLen(p_ring_buffer);
+
+    // Record which does not fit before the end of an empty buffer is placed at the beginning, see RingBuffer_ReserveContinuous
+    if ((free_len == p_ring_buffer->buf_len) || (free_len <= tail_len))
+    {
+        return free_len;
+    }
+
+    size_t head_len = free_len - tail_len;
+
+    return (tail_len > head_len) ? tail_len : head_len;
+}
+
+void RingBuffer_IncrementWrIndex(struct RingBuffer *p_ring_buffer, uint16_t value)
 {
     ASSERT(p_ring_buffer != NULL);
 
-    p_ring_buffer->rd = (p_ring_buffer->rd + value) % p_ring_buffer->buf_len;
+    PublishWrIndex(p_ring_buffer, p_ring_buffer->wr + value);
 }
 
 bool RingBuffer_DequeueByte(struct RingBuffer *p_ring_buffer, uint8_t *p_read_byte)
 {
     ASSERT((p_ring_buffer != NULL) && (p_read_byte != NULL));
 
-    if (RingBuffer_IsEmpty(p_ring_buffer))
+    size_t wr = RING_BUFFER_LOAD_INDEX(&p_ring_buffer->wr);
+    size_t rd = ReadIndex(p_ring_buffer, wr);
+
+    if (rd == wr)
     {
         return false;
     }
-    *p_read_byte = p_ring_buffer->p_buf[(p_ring_buffer->rd)++];
+    *p_read_byte = p_ring_buffer->p_buf[rd & p_ring_buffer->mask];
 
-    if (p_ring_buffer->rd >= p_ring_buffer->buf_len)
-    {
-        p_ring_buffer->rd = 0;
-    }
+    RING_BUFFER_STORE_INDEX(&p_ring_buffer->rd, rd + 1);
 
     return true;
 }
@@ -68,7 +173,7 @@ bool RingBuffer_QueueBytes(struct RingBuffer *p_ring_buffer, uint8_t *p_table, u
     }
 
     uint16_t cpy_len = MaxQueueBufferLen(p_ring_buffer, table_len);
-    memcpy(&p_ring_buffer->p_buf[p_ring_buffer->wr], p_table, cpy_len);
+    memcpy(&p_ring_buffer->p_buf[p_ring_buffer->wr & p_ring_buffer->mask], p_table, cpy_len);
 
     if (cpy_len != table_len)
     {
@@ -76,37 +181,164 @@ bool RingBuffer_QueueBytes(struct RingBuffer *p_ring_buffer, uint8_t *p_table, u
         memcpy(p_ring_buffer->p_buf, &p_table[cpy_len], rest_of_table_len);
     }
 
-    RingBuffer_SetWrIndex(p_ring_buffer, p_ring_buffer->wr + table_len);
+    PublishWrIndex(p_ring_buffer, p_ring_buffer->wr + table_len);
 
     return true;
 }
 
+uint16_t RingBuffer_DequeueBytes(struct RingBuffer *p_ring_buffer, uint8_t *p_dst, uint16_t len)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_dst != NULL));
+
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    size_t wr = RING_BUFFER_LOAD_INDEX(&p_ring_buffer->wr);
+    size_t rd = ReadIndex(p_ring_buffer, wr);
+
+    ReadSpans(p_ring_buffer, wr, rd, spans);
+
+    uint16_t copied_len = CopySpans(spans, p_dst, len);
+
+    RING_BUFFER_STORE_INDEX(&p_ring_buffer->rd, AdvanceReadIndex(p_ring_buffer, wr, rd, copied_len));
+
+    return copied_len;
+}
+
+uint16_t RingBuffer_Peek(struct RingBuffer *p_ring_buffer, uint8_t *p_dst, uint16_t len)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_dst != NULL));
+
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    RingBuffer_GetReadSpans(p_ring_buffer, spans);
+
+    return CopySpans(spans, p_dst, len);
+}
+
+uint16_t RingBuffer_GetReadSpans(struct RingBuffer *p_ring_buffer, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT])
+{
+    ASSERT((p_ring_buffer != NULL) && (p_spans != NULL));
+
+    size_t wr = RING_BUFFER_LOAD_INDEX(&p_ring_buffer->wr);
+    size_t rd = ReadIndex(p_ring_buffer, wr);
+
+    return ReadSpans(p_ring_buffer, wr, rd, p_spans);
+}
+
 uint8_t *RingBuffer_GetMaxContinuousBuffer(struct RingBuffer *p_ring_buffer, uint16_t *p_buf_len)
 {
     ASSERT((p_ring_buffer != NULL) && (p_buf_len != NULL));
 
-    if (p_ring_buffer->rd + RingBuffer_DataLen(p_ring_buffer) > p_ring_buffer->buf_len)
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    RingBuffer_GetReadSpans(p_ring_buffer, spans);
+
+    *p_buf_len = spans[0].len;
+
+    return spans[0].p_buf;
+}
+
+uint16_t RingBuffer_DataLen(struct RingBuffer *p_ring_buffer)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    return RingBuffer_GetReadSpans(p_ring_buffer, spans);
+}
+
+static size_t ReadIndex(struct RingBuffer *p_ring_buffer, size_t wr)
+{
+    size_t rd     = RING_BUFFER_LOAD_INDEX(&p_ring_buffer->rd);
+    size_t offset = rd & p_ring_buffer->mask;
+
+    // Skipped tail does not hold data, the read index is moved over it when data wraps around. End is written
+    // by the producer before the wrapped data is published, and it is not changed until the data is read.
+    if ((offset + (wr - rd) > p_ring_buffer->buf_len) && (offset == p_ring_buffer->end))
     {
-        *p_buf_len = p_ring_buffer->buf_len - p_ring_buffer->rd;
+        return rd + p_ring_buffer->buf_len - offset;
+    }
+
+    return rd;
+}
+
+static uint16_t ReadSpans(struct RingBuffer *p_ring_buffer, size_t wr, size_t rd, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT])
+{
+    size_t offset = rd & p_ring_buffer->mask;
+
+    p_spans[0].p_buf = &p_ring_buffer->p_buf[offset];
+    p_spans[1].p_buf = p_ring_buffer->p_buf;
+
+    if (offset + (wr - rd) > p_ring_buffer->buf_len)
+    {
+        // Data wraps around, first span ends at the end of data before the wrap around and skipped tail is not counted
+        p_spans[0].len = p_ring_buffer->end - offset;
+        p_spans[1].len = wr & p_ring_buffer->mask;
     }
     else
     {
-        *p_buf_len = RingBuffer_DataLen(p_ring_buffer);
+        p_spans[0].len = wr - rd;
+        p_spans[1].len = 0;
     }
 
-    return &p_ring_buffer->p_buf[p_ring_buffer->rd];
+    return p_spans[0].len + p_spans[1].len;
 }
 
-uint16_t RingBuffer_DataLen(struct RingBuffer *p_ring_buffer)
+static size_t AdvanceReadIndex(struct RingBuffer *p_ring_buffer, size_t wr, size_t rd, uint16_t len)
 {
-    ASSERT(p_ring_buffer != NULL);
+    size_t offset = rd & p_ring_buffer->mask;
+
+    if ((offset + (wr - rd) > p_ring_buffer->buf_len) && (offset + len > p_ring_buffer->end))
+    {
+        // Read index is moved over the skipped tail together with the data
+        return rd + len + (p_ring_buffer->buf_len - p_ring_buffer->end);
+    }
+
+    return rd + len;
+}
+
+static uint16_t CopySpans(struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT], uint8_t *p_dst, uint16_t len)
+{
+    uint16_t copied_len = 0;
+    size_t   i;
+
+    for (i = 0; (i < RING_BUFFER_SPANS_CNT) && (copied_len < len); i++)
+    {
+        uint16_t cpy_len = p_spans[i].len;
+
+        if (cpy_len > len - copied_len)
+        {
+            cpy_len = len - copied_len;
+        }
+
+        memcpy(&p_dst[copied_len], p_spans[i].p_buf, cpy_len);
+        copied_len += cpy_len;
+    }
 
-    return (p_ring_buffer->wr - p_ring_buffer->rd) % p_ring_buffer->buf_len;
+    return copied_len;
+}
+
+static size_t FreeLen(struct RingBuffer *p_ring_buffer)
+{
+    return p_ring_buffer->buf_len - (p_ring_buffer->wr - ReadIndex(p_ring_buffer, p_ring_buffer->wr));
+}
+
+static void PublishWrIndex(struct RingBuffer *p_ring_buffer, size_t wr)
+{
+    size_t offset = p_ring_buffer->wr & p_ring_buffer->mask;
+
+    if ((wr != p_ring_buffer->wr) && ((offset == 0) || (offset + (wr - p_ring_buffer->wr) > p_ring_buffer->buf_len)))
+    {
+        // Data wraps around without skipping the tail
+        p_ring_buffer->end = p_ring_buffer->buf_len;
+    }
+
+    RING_BUFFER_STORE_INDEX(&p_ring_buffer->wr, wr);
 }
 
 static bool IsOverflow(struct RingBuffer *p_ring_buffer, uint16_t len)
 {
-    return (len + RingBuffer_DataLen(p_ring_buffer)) > p_ring_buffer->buf_len;
+    return len > FreeLen(p_ring_buffer);
 }
 
 static uint16_t MaxQueueBufferLen(struct RingBuffer *p_ring_buffer, uint16_t table_len)
@@ -116,9 +348,11 @@ static uint16_t MaxQueueBufferLen(struct RingBuffer *p_ring_buffer, uint16_t tab
         return 0;
     }
 
-    if (p_ring_buffer->wr + table_len > p_ring_buffer->buf_len)
+    size_t tail_len = p_ring_buffer->buf_len - (p_ring_buffer->wr & p_ring_buffer->mask);
+
+    if (table_len > tail_len)
     {
-        return p_ring_buffer->buf_len - p_ring_buffer->wr;
+        return tail_len;
     }
     else
     {
@@ -5,14 +5,43 @@
 #include <stddef.h>
 #include <stdint.h>
 
+// Data in ring buffer is split into at most two continuous regions - before and after the end of the buffer
+#define RING_BUFFER_SPANS_CNT 2
+
+struct RingBufferSpan
+{
+    uint8_t *p_buf;
+    uint16_t len;
+};
+
+/*
+ *  Single producer, single consumer ring buffer. Write index and skipped tail are modified only by the producer,
+ *  read index only by the consumer, so one side can run in an interrupt without critical section.
+ *  Buffer length is a power of two, indices are free running and wrapped around with a mask.
+ *
+ *  Producer:   RingBuffer_QueueBytes, RingBuffer_Reserve, RingBuffer_IncrementWrIndex, RingBuffer_ReserveContinuous,
+ *              RingBuffer_CommitContinuous, RingBuffer_GetMaxContinuousFreeLen
+ *  Consumer:   RingBuffer_DequeueByte, RingBuffer_DequeueBytes, RingBuffer_Peek, RingBuffer_GetReadSpans,
+ *              RingBuffer_GetMaxContinuousBuffer, RingBuffer_IncrementRdIndex
+ *  Both:       RingBuffer_IsEmpty, RingBuffer_DataLen
+ */
 struct RingBuffer
 {
     uint8_t *p_buf;
     size_t   buf_len;
-    size_t   wr;
-    size_t   rd;
+    size_t   mask;
+    size_t   wr;     // Free running, modified by the producer
+    size_t   rd;     // Free running, modified by the consumer
+    size_t   end;    // End of data before wrap around, smaller than buf_len when the tail of the buffer is skipped
 };
 
+/*
+ *  Initialize ring buffer
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param p_buf_pointer    Data buffer
+ *  @param buf_len          Data buffer length, has to be a power of two
+ */
 void RingBuffer_Init(struct RingBuffer *p_ring_buffer, uint8_t *p_buf_pointer, size_t buf_len);
 
 bool RingBuffer_IsEmpty(struct RingBuffer *p_ring_buffer);
@@ -21,10 +50,80 @@ bool RingBuffer_QueueBytes(struct RingBuffer *p_ring_buffer, uint8_t *p_table, u
 
 bool RingBuffer_DequeueByte(struct RingBuffer *p_ring_buffer, uint8_t *p_read_byte);
 
-void RingBuffer_SetWrIndex(struct RingBuffer *p_ring_buffer, uint16_t value);
+/*
+ *  Copy data from the ring buffer and remove it
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param p_dst            [out] Destination buffer
+ *  @param len              Maximum number of bytes to copy
+ *  @return                 Number of copied bytes, smaller than len if there is not enough data
+ */
+uint16_t RingBuffer_DequeueBytes(struct RingBuffer *p_ring_buffer, uint8_t *p_dst, uint16_t len);
+
+/*
+ *  Copy data from the ring buffer without removing it
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param p_dst            [out] Destination buffer
+ *  @param len              Maximum number of bytes to copy
+ *  @return                 Number of copied bytes, smaller than len if there is not enough data
+ */
+uint16_t RingBuffer_Peek(struct RingBuffer *p_ring_buffer, uint8_t *p_dst, uint16_t len);
+
+/*
+ *  Get all data in the ring buffer, without moving the read index. Data is processed directly
+ *  from the returned spans and removed with RingBuffer_IncrementRdIndex.
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param p_spans          [out] Data regions, second one is empty if data does not wrap around
+ *  @return                 Number of bytes in both spans
+ */
+uint16_t RingBuffer_GetReadSpans(struct RingBuffer *p_ring_buffer, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT]);
 
 void RingBuffer_IncrementRdIndex(struct RingBuffer *p_ring_buffer, uint16_t value);
 
+/*
+ *  Reserve space for data at the write index, without moving the index. Data is written
+ *  directly to the returned spans and queued with RingBuffer_IncrementWrIndex.
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param len              Number of bytes to reserve
+ *  @param p_spans          [out] Reserved regions, second one is empty if the space does not wrap around
+ *  @return                 True if space is available
+ */
+bool RingBuffer_Reserve(struct RingBuffer *p_ring_buffer, uint16_t len, struct RingBufferSpan p_spans[RING_BUFFER_SPANS_CNT]);
+
+/*
+ *  Reserve continuous space for a record at the write index, without moving the index. When the record
+ *  does not fit before the end of the buffer, the tail of the buffer is skipped and the space is reserved
+ *  at the beginning, so the record is never split by RingBuffer_GetMaxContinuousBuffer. Reserved space is
+ *  queued with RingBuffer_CommitContinuous.
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param len              Number of bytes to reserve
+ *  @param p_span           [out] Reserved region
+ *  @return                 True if space is available
+ */
+bool RingBuffer_ReserveContinuous(struct RingBuffer *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span);
+
+/*
+ *  Queue record written to the space reserved with RingBuffer_ReserveContinuous
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @param p_span           Region returned by RingBuffer_ReserveContinuous
+ */
+void RingBuffer_CommitContinuous(struct RingBuffer *p_ring_buffer, struct RingBufferSpan *p_span);
+
+/*
+ *  Get the longest record which can be reserved with RingBuffer_ReserveContinuous
+ *
+ *  @param p_ring_buffer    Pointer to ring buffer
+ *  @return                 Number of bytes
+ */
+uint16_t RingBuffer_GetMaxContinuousFreeLen(struct RingBuffer *p_ring_buffer);
+
+void RingBuffer_IncrementWrIndex(struct RingBuffer *p_ring_buffer, uint16_t value);
+
 uint16_t RingBuffer_DataLen(struct RingBuffer *p_ring_buffer);
 
 uint8_t *RingBuffer_GetMaxContinuousBuffer(struct RingBuffer *p_ring_buffer, uint16_t *p_buf_len);
@@ -19,7 +19,7 @@ void SimpleScheduler_TaskAdd(uint32_t period_ms, void (*const p_cb)(void), enum
 {
     ASSERT((p_cb != NULL) && (task_id < SIMPLE_SCHEDULER_TASK_ID_LENGTH_MARKER) && (TaskList[NumberOfTaskCnt].p_cb == NULL));
 
-    LOG_D("New task added, id: %u, ptr: 0x%08X", task_id, (uintptr_t)p_cb);
+    LOG_D("New task added, id: %u, ptr: 0x%08lX", task_id, (unsigned long)(uintptr_t)p_cb);
 
     TaskList[NumberOfTaskCnt].period_ms                = period_ms;
     TaskList[NumberOfTaskCnt].p_cb                     = p_cb;
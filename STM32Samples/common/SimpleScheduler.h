@@ -12,6 +12,9 @@ enum SimpleSchedulerTaskId
     SIMPLE_SCHEDULER_TASK_ID_LCD,
     SIMPLE_SCHEDULER_TASK_ID_ATTENTION,
     SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL,
+    SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX,
+    SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE,
+    SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS,
     SIMPLE_SCHEDULER_TASK_ID_HEALTH,
     SIMPLE_SCHEDULER_TASK_ID_LIGHT_LIGHTNESS,
     SIMPLE_SCHEDULER_TASK_ID_EMG_L_TEST,
@@ -22,6 +25,8 @@ enum SimpleSchedulerTaskId
     SIMPLE_SCHEDULER_TASK_ID_WATCHDOG,
     SIMPLE_SCHEDULER_TASK_ID_ENERGY_SENSOR_SIMULATOR,
     SIMPLE_SCHEDULER_TASK_ID_EMERGENCY_DRIVER_SIMULATOR,
+    SIMPLE_SCHEDULER_TASK_ID_UART_BAUDRATE,
+    SIMPLE_SCHEDULER_TASK_ID_STARTUP,
     SIMPLE_SCHEDULER_TASK_ID_LENGTH_MARKER,
 };
 
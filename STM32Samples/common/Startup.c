@@ -0,0 +1,141 @@
+#include "Startup.h"
+
+#include <stddef.h>
+
+#include "Assert.h"
+#include "Log.h"
+#include "SimpleScheduler.h"
+#include "Timestamp.h"
+
+#define STARTUP_TASK_PERIOD_MS 0
+
+#define STARTUP_MAX_NUMBER_OF_SEQUENCES 8
+
+struct StartupSequenceState
+{
+    const struct StartupSequence *p_sequence;
+
+    uint32_t step_timestamp;
+    uint32_t done_timestamp;
+    size_t   step_idx;
+    bool     is_step_waiting;
+};
+
+static struct StartupSequenceState Sequences[STARTUP_MAX_NUMBER_OF_SEQUENCES];
+static size_t                      SequencesCnt = 0;
+
+static StartupDoneCallback_T DoneCallback   = NULL;
+static uint32_t              StartTimestamp = 0;
+static bool                  IsStarted      = false;
+static bool                  IsDone         = false;
+
+static void Startup_Process(void);
+static bool Startup_ProcessSequence(struct StartupSequenceState *p_state);
+static void Startup_LogProfile(void);
+
+void Startup_AddSequence(const struct StartupSequence *p_sequence)
+{
+    ASSERT((p_sequence != NULL) && (p_sequence->p_steps != NULL) && (p_sequence->steps_cnt != 0));
+    ASSERT((SequencesCnt < STARTUP_MAX_NUMBER_OF_SEQUENCES) && !IsStarted);
+
+    LOG_D("New startup sequence added: %s", p_sequence->p_name);
+
+    Sequences[SequencesCnt].p_sequence      = p_sequence;
+    Sequences[SequencesCnt].step_idx        = 0;
+    Sequences[SequencesCnt].is_step_waiting = false;
+    SequencesCnt++;
+}
+
+void Startup_Start(StartupDoneCallback_T p_done_callback)
+{
+    ASSERT((p_done_callback != NULL) && !IsStarted);
+
+    DoneCallback   = p_done_callback;
+    StartTimestamp = Timestamp_GetCurrent();
+    IsStarted      = true;
+
+    SimpleScheduler_TaskAdd(STARTUP_TASK_PERIOD_MS, Startup_Process, SIMPLE_SCHEDULER_TASK_ID_STARTUP, true);
+}
+
+bool Startup_IsDone(void)
+{
+    return IsDone;
+}
+
+static void Startup_Process(void)
+{
+    bool is_done = true;
+
+    size_t i;
+    for (i = 0; i < SequencesCnt; i++)
+    {
+        if (!Startup_ProcessSequence(&Sequences[i]))
+        {
+            is_done = false;
+        }
+    }
+
+    if (!is_done)
+    {
+        return;
+    }
+
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_STARTUP, false);
+
+    IsDone = true;
+
+    DoneCallback();
+
+    Startup_LogProfile();
+}
+
+static bool Startup_ProcessSequence(struct StartupSequenceState *p_state)
+{
+    const struct StartupSequence *p_sequence = p_state->p_sequence;
+
+    while (p_state->step_idx < p_sequence->steps_cnt)
+    {
+        const struct StartupStep *p_step = &p_sequence->p_steps[p_state->step_idx];
+
+        if (!p_state->is_step_waiting)
+        {
+            if ((p_step->p_action != NULL) && !p_step->p_action())
+            {
+                return false;
+            }
+
+            p_state->step_timestamp  = Timestamp_GetCurrent();
+            p_state->is_step_waiting = true;
+        }
+
+        if (Timestamp_GetTimeElapsed(p_state->step_timestamp, Timestamp_GetCurrent()) < p_step->delay_ms)
+        {
+            return false;
+        }
+
+        p_state->is_step_waiting = false;
+        p_state->step_idx++;
+
+        if (p_state->step_idx == p_sequence->steps_cnt)
+        {
+            p_state->done_timestamp = Timestamp_GetCurrent();
+        }
+    }
+
+    return true;
+}
+
+static void Startup_LogProfile(void)
+{
+    // Timestamps are counted from reset
+    LOG_D("Boot profile:");
+    LOG_D("  Initialization done: %u ms", (unsigned int)StartTimestamp);
+
+    size_t i;
+    for (i = 0; i < SequencesCnt; i++)
+    {
+        LOG_D("  %s done: %u ms", Sequences[i].p_sequence->p_name, (unsigned int)Sequences[i].done_timestamp);
+    }
+
+    LOG_D("  Startup done: %u ms", (unsigned int)Timestamp_GetCurrent());
+}
@@ -0,0 +1,53 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ *  Startup step action
+ *
+ *  @return   True if the action is done, false if it has to be called again in the next task run
+ */
+typedef bool (*StartupStepAction_T)(void);
+
+typedef void (*StartupDoneCallback_T)(void);
+
+/*
+ *  Startup step, the action is called first and the next step is started when the delay elapses
+ */
+struct StartupStep
+{
+    StartupStepAction_T p_action; /**< Optional, the step is a plain delay without it */
+    uint32_t            delay_ms;
+};
+
+/*
+ *  Startup sequence, steps of one sequence are executed in order, while steps of different sequences overlap
+ */
+struct StartupSequence
+{
+    const char               *p_name; /**< Reported in the boot profile */
+    const struct StartupStep *p_steps;
+    size_t                    steps_cnt;
+};
+
+/*
+ *  Add sequence executed during startup, it has to be added before Startup_Start is called
+ *
+ *  @param p_sequence   Sequence, has to be valid until the startup is done
+ */
+void Startup_AddSequence(const struct StartupSequence *p_sequence);
+
+/*
+ *  Start executing added sequences in the scheduler task. When all of them are done, the boot profile is logged
+ *  and the callback is called.
+ *
+ *  @param p_done_callback   Called when the startup is done
+ */
+void Startup_Start(StartupDoneCallback_T p_done_callback);
+
+bool Startup_IsDone(void);
+
+#endif
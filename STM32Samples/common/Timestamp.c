@@ -45,8 +45,10 @@ uint32_t Timestamp_GetTimeElapsed(uint32_t timestamp_earlier, uint32_t timestamp
 
 void Timestamp_DelayMs(uint32_t delay_time)
 {
-    delay_time = Timestamp_GetCurrent() + delay_time;
-    while (delay_time - Timestamp_GetCurrent() != 0)
+    uint32_t start_time = Timestamp_GetCurrent();
+
+    // Elapsed time is compared, so the delay ends also when the timestamp skips values, e.g. in the POSIX host build
+    while (Timestamp_GetTimeElapsed(start_time, Timestamp_GetCurrent()) < delay_time)
     {
         // Do nothing
     }
@@ -6,6 +6,7 @@
 #include "Assert.h"
 #include "Checksum.h"
 #include "Log.h"
+#include "TickHal.h"
 #include "UartHal.h"
 
 
@@ -26,11 +27,46 @@
 
 #define UART_FRAME_CRC16_INIT_VAL 0xFFFFu
 
+// RX DMA buffer is circular, so received data is split into at most two continuous buffers
+#define UART_FRAME_RX_MAX_CONTINUOUS_BUFFERS 2
+
 
 static bool IsInitialized = false;
 
-static enum UartFrameStatus UartFrame_Decode(uint8_t received_byte, struct UartFrameRxTxFrame *p_rx_frame);
-static uint16_t             UartFrame_CalculateCrc16(uint8_t len, uint8_t cmd, uint8_t *p_data);
+static uint16_t FrameCrc         = 0;
+static uint16_t FrameReceivedCrc = 0;
+static uint8_t  FrameByteCnt     = 0;
+
+// Bytes of an invalid frame which are decoded again, so a valid frame starting inside it is not lost
+static uint8_t ResyncBytes[UART_FRAME_FRAME_LEN(UART_FRAME_MAX_PAYLOAD_LEN)];
+static uint8_t ResyncLen = 0;
+static uint8_t ResyncIdx = 0;
+
+static uint32_t RxFramesCnt         = 0;
+static uint32_t RxCrcErrorsCnt      = 0;
+static uint32_t RxPreambleErrorsCnt = 0;
+static uint32_t RxLengthErrorsCnt   = 0;
+static uint32_t RxCommandErrorsCnt  = 0;
+
+static uint32_t TxFramesCnt = 0;
+
+#if UART_FRAME_READY_TICK_ENABLE
+static uint32_t FrameReadyTick = 0;
+#endif
+
+static bool                   UartFrame_ReadByte(uint8_t *p_byte);
+static bool                   UartFrame_IsFrameReady(enum UartFrameStatus status, struct UartFrameRxTxFrame *p_rx_frame);
+static void                   UartFrame_CountRxError(enum UartFrameStatus status);
+static bool                   UartFrame_DecodeBuffer(uint8_t *p_buf, size_t buf_len, struct UartFrameRxTxFrame *p_rx_frame,
+                                                     UartFrameRxFrameHandler_T p_frame_handler, size_t *p_decoded_len, size_t *p_frames_cnt);
+static size_t                 UartFrame_DecodeInPlace(uint8_t *p_buf, size_t buf_len, struct UartFrameRxTxFrame *p_rx_frame);
+static bool                   UartFrame_IsCommandValid(uint8_t cmd);
+static enum UartHalTxPriority UartFrame_GetTxPriority(enum UartFrameCmd cmd);
+static enum UartFrameStatus   UartFrame_Decode(uint8_t received_byte, struct UartFrameRxTxFrame *p_rx_frame);
+static void                   UartFrame_Resync(uint8_t received_byte, struct UartFrameRxTxFrame *p_rx_frame);
+static uint16_t               UartFrame_CalculateCrc16(uint8_t len, uint8_t cmd, uint8_t *p_data);
+static bool                   UartFrame_Transmit(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt, uint16_t crc);
+static void                   UartFrame_WriteTx(struct UartHalTxReservation *p_reservation, size_t *p_offset, uint8_t *p_data, size_t len);
 
 void UartFrame_Init(void)
 {
@@ -56,16 +92,213 @@ bool UartFrame_ProcessIncomingData(struct UartFrameRxTxFrame *p_rx_frame)
     ASSERT(p_rx_frame != NULL);
 
     uint8_t received_byte;
-    if (!UartHal_ReadByte(&received_byte))
+    if (!UartFrame_ReadByte(&received_byte))
     {
         return false;
     }
 
     enum UartFrameStatus status = UartFrame_Decode(received_byte, p_rx_frame);
 
+    return UartFrame_IsFrameReady(status, p_rx_frame);
+}
+
+size_t UartFrame_ProcessIncomingDataBulk(struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler)
+{
+    ASSERT((p_rx_frame != NULL) && (p_frame_handler != NULL));
+
+    size_t frames_cnt = 0;
+
+    size_t i;
+    for (i = 0; i < UART_FRAME_RX_MAX_CONTINUOUS_BUFFERS; i++)
+    {
+        uint16_t buf_len;
+        uint8_t *p_buf = UartHal_GetRxMaxContinuousBuffer(&buf_len);
+
+        // Resync bytes left after the handler stopped decoding are decoded even if no new data was received
+        if ((buf_len == 0) && (ResyncIdx == ResyncLen))
+        {
+            break;
+        }
+
+        size_t decoded_len;
+        bool   is_stopped = UartFrame_DecodeBuffer(p_buf, buf_len, p_rx_frame, p_frame_handler, &decoded_len, &frames_cnt);
+
+        UartHal_IncrementRxRdIndex(decoded_len);
+
+        if (is_stopped)
+        {
+            break;
+        }
+    }
+
+    return frames_cnt;
+}
+
+void UartFrame_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    if (!UartFrame_TrySend(cmd, p_payload, len))
+    {
+        // TX buffer is full
+        ASSERT(false);
+    }
+}
+
+void UartFrame_SendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    if (!UartFrame_TrySendV(cmd, p_segments, segments_cnt))
+    {
+        // TX buffer is full or payload is too long
+        ASSERT(false);
+    }
+}
+
+bool UartFrame_TrySend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    struct UartFrameSegment segment = {
+        .p_data = p_payload,
+        .len    = len,
+    };
+
+    return UartFrame_Transmit(cmd, &segment, 1, UartFrame_CalculateCrc16(len, cmd, p_payload));
+}
+
+bool UartFrame_TrySendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    ASSERT((p_segments != NULL) || (segments_cnt == 0));
+
+    uint16_t crc = UART_FRAME_CRC16_INIT_VAL;
+    size_t   len = 0;
+    size_t   i;
+
+    for (i = 0; i < segments_cnt; i++)
+    {
+        len += p_segments[i].len;
+    }
+
+    if (len > UART_FRAME_MAX_PAYLOAD_LEN)
+    {
+        // Invalid frame is dropped, it would not fit in the TX buffer later either
+        ASSERT(false);
+        return false;
+    }
+
+    crc = Checksum_UpdateCRC16((uint8_t)len, crc);
+    crc = Checksum_UpdateCRC16(cmd, crc);
+
+    for (i = 0; i < segments_cnt; i++)
+    {
+        crc = Checksum_CalcCRC16(p_segments[i].p_data, p_segments[i].len, crc);
+    }
+
+    return UartFrame_Transmit(cmd, p_segments, segments_cnt, crc);
+}
+
+bool UartFrame_IsTxSpaceAvailable(enum UartFrameCmd cmd, uint8_t len)
+{
+    return UartHal_GetTxFreeSpace(UartFrame_GetTxPriority(cmd)) >= UART_FRAME_FRAME_LEN(len);
+}
+
+void UartFrame_Flush(void)
+{
+    UartHal_Flush();
+}
+
+void UartFrame_SetBaudrate(uint32_t baudrate)
+{
+    UartHal_SetBaudrate(baudrate);
+}
+
+uint32_t UartFrame_GetBaudrate(void)
+{
+    return UartHal_GetBaudrate();
+}
+
+bool UartFrame_IsRxDataAvailable(void)
+{
+    // Bytes left for resynchronization are received data as well
+    return (ResyncIdx < ResyncLen) || UartHal_IsRxDataAvailable();
+}
+
+void UartFrame_SetRxDataCallback(void (*p_callback)(void))
+{
+    UartHal_SetRxDataIrq(p_callback);
+}
+
+void UartFrame_GetRxStats(struct UartFrameRxStats *p_stats)
+{
+    ASSERT(p_stats != NULL);
+
+    struct UartHalRxStats hal_stats;
+    UartHal_GetRxStats(&hal_stats);
+
+    p_stats->bytes_cnt              = hal_stats.bytes_cnt;
+    p_stats->frames_cnt             = RxFramesCnt;
+    p_stats->crc_errors_cnt         = RxCrcErrorsCnt;
+    p_stats->preamble_errors_cnt    = RxPreambleErrorsCnt;
+    p_stats->length_errors_cnt      = RxLengthErrorsCnt;
+    p_stats->command_errors_cnt     = RxCommandErrorsCnt;
+    p_stats->overruns_cnt           = hal_stats.overruns_cnt;
+    p_stats->buffer_high_water_mark = hal_stats.high_water_mark;
+    p_stats->buffer_len             = hal_stats.buffer_len;
+}
+
+void UartFrame_SetTxCoalescing(bool is_enable, uint32_t window_us)
+{
+    UartHal_SetTxCoalescing(is_enable, window_us);
+}
+
+void UartFrame_ProcessPendingTx(void)
+{
+    UartHal_ProcessPendingTx();
+}
+
+void UartFrame_GetTxStats(struct UartFrameTxStats *p_stats)
+{
+    ASSERT(p_stats != NULL);
+
+    p_stats->frames_cnt        = TxFramesCnt;
+    p_stats->dma_transfers_cnt = UartHal_GetTxDmaTransfersCnt();
+}
+
+#if UART_FRAME_READY_TICK_ENABLE
+uint32_t UartFrame_GetFrameReadyTick(void)
+{
+    return FrameReadyTick;
+}
+#endif
+
+void UartFrame_ClearRxStats(void)
+{
+    UartHal_ClearRxStats();
+
+    RxFramesCnt         = 0;
+    RxCrcErrorsCnt      = 0;
+    RxPreambleErrorsCnt = 0;
+    RxLengthErrorsCnt   = 0;
+    RxCommandErrorsCnt  = 0;
+}
+
+static bool UartFrame_ReadByte(uint8_t *p_byte)
+{
+    if (ResyncIdx < ResyncLen)
+    {
+        *p_byte = ResyncBytes[ResyncIdx];
+        ResyncIdx++;
+        return true;
+    }
+
+    return UartHal_ReadByte(p_byte);
+}
+
+static bool UartFrame_IsFrameReady(enum UartFrameStatus status, struct UartFrameRxTxFrame *p_rx_frame)
+{
     switch (status)
     {
         case UART_FRAME_STATUS_FRAME_READY:
+#if UART_FRAME_READY_TICK_ENABLE
+            FrameReadyTick = TickHal_GetClockTick();
+#endif
+            RxFramesCnt++;
 #if UART_FRAME_LOGGER_ENABLE
             LOG_D("Frame received: len: %u, cmd, 0x%02X", p_rx_frame->len, p_rx_frame->cmd);
             LOG_HEX_D("Payload:", p_rx_frame->p_payload, p_rx_frame->len);
@@ -80,6 +313,7 @@ bool UartFrame_ProcessIncomingData(struct UartFrameRxTxFrame *p_rx_frame)
         case UART_FRAME_STATUS_COMMAND_ERROR:
         case UART_FRAME_STATUS_CRC_ERROR:
         case UART_FRAME_STATUS_ERROR_UNKNOWN:
+            UartFrame_CountRxError(status);
             LOG_W("Frame received error: 0x%02X, len: %u, cmd: 0x%02X", status, p_rx_frame->len, p_rx_frame->cmd);
             LOG_HEX_W("Payload:", p_rx_frame->p_payload, p_rx_frame->len);
             return false;
@@ -92,137 +326,301 @@ bool UartFrame_ProcessIncomingData(struct UartFrameRxTxFrame *p_rx_frame)
     return false;
 }
 
-void UartFrame_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+static void UartFrame_CountRxError(enum UartFrameStatus status)
 {
-    ASSERT((len <= UART_FRAME_MAX_PAYLOAD_LEN) && (((cmd >= UART_FRAME_CMD_RANGE1_START) && (cmd <= UART_FRAME_CMD_RANGE1_END)) ||
-                                                   ((cmd >= UART_FRAME_CMD_RANGE2_START) && (cmd <= UART_FRAME_CMD_RANGE2_END))));
+    switch (status)
+    {
+        case UART_FRAME_STATUS_PREAMBLE_ERROR:
+            RxPreambleErrorsCnt++;
+            break;
 
-    uint16_t crc;
-    uint8_t  frame[UART_FRAME_FRAME_LEN(len)];
+        case UART_FRAME_STATUS_LENGTH_ERROR:
+            RxLengthErrorsCnt++;
+            break;
+
+        case UART_FRAME_STATUS_COMMAND_ERROR:
+            RxCommandErrorsCnt++;
+            break;
+
+        case UART_FRAME_STATUS_CRC_ERROR:
+            RxCrcErrorsCnt++;
+            break;
+
+        default:
+            break;
+    }
+}
+
+static bool UartFrame_DecodeBuffer(uint8_t *p_buf, size_t buf_len, struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler,
+                                   size_t *p_decoded_len, size_t *p_frames_cnt)
+{
+    bool   is_stopped = false;
+    size_t i          = 0;
+
+    while ((i < buf_len) || (ResyncIdx < ResyncLen))
+    {
+        enum UartFrameStatus status;
+
+        if (ResyncIdx < ResyncLen)
+        {
+            // Bytes of an invalid frame are decoded again before the rest of the buffer
+            uint8_t resync_byte = ResyncBytes[ResyncIdx];
+            ResyncIdx++;
+
+            status = UartFrame_Decode(resync_byte, p_rx_frame);
+        }
+        else if (FrameByteCnt == UART_FRAME_PREAMBLE_BYTE_1_OFFSET)
+        {
+            // Between frames the decoder drops every byte other than the first preamble byte, so skip them at once
+            uint8_t *p_preamble = memchr(&p_buf[i], UART_FRAME_PREAMBLE_BYTE_1, buf_len - i);
+            if (p_preamble == NULL)
+            {
+                i = buf_len;
+                break;
+            }
+            i = p_preamble - p_buf;
+
+            size_t frame_len = UartFrame_DecodeInPlace(&p_buf[i], buf_len - i, p_rx_frame);
+            if (frame_len != 0)
+            {
+                status = UART_FRAME_STATUS_FRAME_READY;
+                i += frame_len;
+            }
+            else
+            {
+                // Frame is not complete in this buffer or it is invalid - use the byte by byte decoder
+                status = UartFrame_Decode(p_buf[i], p_rx_frame);
+                i++;
+            }
+        }
+        else
+        {
+            status = UartFrame_Decode(p_buf[i], p_rx_frame);
+            i++;
+        }
+
+        if (UartFrame_IsFrameReady(status, p_rx_frame))
+        {
+            (*p_frames_cnt)++;
+
+            if (!p_frame_handler(p_rx_frame))
+            {
+                // Pending resync bytes are kept and decoded first on the next call, before the rest of the RX buffer
+                is_stopped = true;
+                break;
+            }
+        }
+    }
 
-    frame[UART_FRAME_PREAMBLE_BYTE_1_OFFSET] = UART_FRAME_PREAMBLE_BYTE_1;
-    frame[UART_FRAME_PREAMBLE_BYTE_2_OFFSET] = UART_FRAME_PREAMBLE_BYTE_2;
-    frame[UART_FRAME_LEN_OFFSET]             = len;
-    frame[UART_FRAME_CMD_OFFSET]             = cmd;
+    *p_decoded_len = i;
 
-    if (p_payload != NULL)
+    return is_stopped;
+}
+
+static size_t UartFrame_DecodeInPlace(uint8_t *p_buf, size_t buf_len, struct UartFrameRxTxFrame *p_rx_frame)
+{
+    if ((buf_len < UART_FRAME_FRAME_LEN(0)) || (p_buf[UART_FRAME_PREAMBLE_BYTE_1_OFFSET] != UART_FRAME_PREAMBLE_BYTE_1) ||
+        (p_buf[UART_FRAME_PREAMBLE_BYTE_2_OFFSET] != UART_FRAME_PREAMBLE_BYTE_2))
     {
-        memcpy(frame + UART_FRAME_PAYLOAD_OFFSET, p_payload, len);
+        return 0;
     }
 
-    crc = UartFrame_CalculateCrc16(len, cmd, p_payload);
+    uint8_t len = p_buf[UART_FRAME_LEN_OFFSET];
+    uint8_t cmd = p_buf[UART_FRAME_CMD_OFFSET];
 
-    frame[UART_FRAME_CRC_BYTE_1_OFFSET(len)] = LOW_BYTE(crc);
-    frame[UART_FRAME_CRC_BYTE_2_OFFSET(len)] = HIGH_BYTE(crc);
+    if ((len > UART_FRAME_MAX_PAYLOAD_LEN) || (buf_len < (size_t)UART_FRAME_FRAME_LEN(len)) || !UartFrame_IsCommandValid(cmd))
+    {
+        return 0;
+    }
 
-    UartHal_SendBuffer(frame, UART_FRAME_FRAME_LEN(len));
+    // Length, command and payload are adjacent in the frame, so CRC can be calculated directly over the RX buffer
+    uint16_t crc = Checksum_CalcCRC16(&p_buf[UART_FRAME_LEN_OFFSET], sizeof(len) + sizeof(cmd) + len, UART_FRAME_CRC16_INIT_VAL);
 
-#if UART_FRAME_LOGGER_ENABLE
-    LOG_D("Frame sent: len: %u, cmd: 0x%02X", len, cmd);
-    LOG_HEX_D("Payload:", p_payload, len);
-#endif
+    if ((p_buf[UART_FRAME_CRC_BYTE_1_OFFSET(len)] != LOW_BYTE(crc)) || (p_buf[UART_FRAME_CRC_BYTE_2_OFFSET(len)] != HIGH_BYTE(crc)))
+    {
+        return 0;
+    }
+
+    p_rx_frame->len = len;
+    p_rx_frame->cmd = (enum UartFrameCmd)cmd;
+    memcpy(p_rx_frame->p_payload, &p_buf[UART_FRAME_PAYLOAD_OFFSET], len);
+
+    return UART_FRAME_FRAME_LEN(len);
 }
 
-void UartFrame_Flush(void)
+static bool UartFrame_IsCommandValid(uint8_t cmd)
 {
-    UartHal_Flush();
+    return ((cmd >= UART_FRAME_CMD_RANGE1_START) && (cmd <= UART_FRAME_CMD_RANGE1_END)) ||
+           ((cmd >= UART_FRAME_CMD_RANGE2_START) && (cmd <= UART_FRAME_CMD_RANGE2_END));
+}
+
+static enum UartHalTxPriority UartFrame_GetTxPriority(enum UartFrameCmd cmd)
+{
+    // Frames guarded by modem-side timeouts are not delayed by bulk traffic
+    if ((cmd >= UART_FRAME_CMD_RANGE2_START) && (cmd <= UART_FRAME_CMD_RANGE2_END))
+    {
+        return UART_HAL_TX_PRIORITY_HIGH;
+    }
+
+    // Only commands sent by the MCU are listed
+    switch (cmd)
+    {
+        case UART_FRAME_CMD_PING_REQUEST:
+        case UART_FRAME_CMD_PONG_RESPONSE:
+        case UART_FRAME_CMD_START_NODE_REQUEST:
+        case UART_FRAME_CMD_FACTORY_RESET_REQUEST:
+        case UART_FRAME_CMD_SOFTWARE_RESET_REQUEST:
+        case UART_FRAME_CMD_BAUDRATE_SET_REQ:
+            return UART_HAL_TX_PRIORITY_HIGH;
+
+        default:
+            return UART_HAL_TX_PRIORITY_NORMAL;
+    }
 }
 
 static enum UartFrameStatus UartFrame_Decode(uint8_t received_byte, struct UartFrameRxTxFrame *p_rx_frame)
 {
     ASSERT(p_rx_frame != NULL);
 
-    static uint16_t crc            = 0;
-    static uint8_t  frame_byte_cnt = 0;
-
-    if (frame_byte_cnt == UART_FRAME_PREAMBLE_BYTE_1_OFFSET)
+    if (FrameByteCnt == UART_FRAME_PREAMBLE_BYTE_1_OFFSET)
     {
         if (received_byte == UART_FRAME_PREAMBLE_BYTE_1)
         {
-            frame_byte_cnt++;
+            FrameByteCnt++;
             p_rx_frame->len = 0;
             p_rx_frame->cmd = (enum UartFrameCmd)0;
             return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
         }
 
-        frame_byte_cnt = 0;
+        FrameByteCnt = 0;
         // This is first byte of the frame. If we start receiving frame from the middle byte we can enter in this case.
         return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
     }
 
-    if (frame_byte_cnt == UART_FRAME_PREAMBLE_BYTE_2_OFFSET)
+    if (FrameByteCnt == UART_FRAME_PREAMBLE_BYTE_2_OFFSET)
     {
         if (received_byte == UART_FRAME_PREAMBLE_BYTE_2)
         {
-            frame_byte_cnt++;
+            FrameByteCnt++;
             return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
         }
 
-        frame_byte_cnt = 0;
+        UartFrame_Resync(received_byte, p_rx_frame);
+        FrameByteCnt = 0;
         return UART_FRAME_STATUS_PREAMBLE_ERROR;
     }
 
-    if (frame_byte_cnt == UART_FRAME_LEN_OFFSET)
+    if (FrameByteCnt == UART_FRAME_LEN_OFFSET)
     {
         if (received_byte <= UART_FRAME_MAX_PAYLOAD_LEN)
         {
             p_rx_frame->len = received_byte;
-            frame_byte_cnt++;
+            FrameCrc        = Checksum_UpdateCRC16(received_byte, UART_FRAME_CRC16_INIT_VAL);
+            FrameByteCnt++;
             return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
         }
 
-        frame_byte_cnt = 0;
+        UartFrame_Resync(received_byte, p_rx_frame);
+        FrameByteCnt = 0;
         return UART_FRAME_STATUS_LENGTH_ERROR;
     }
 
-    if (frame_byte_cnt == UART_FRAME_CMD_OFFSET)
+    if (FrameByteCnt == UART_FRAME_CMD_OFFSET)
     {
-        if (((received_byte >= UART_FRAME_CMD_RANGE1_START) && (received_byte <= UART_FRAME_CMD_RANGE1_END)) ||
-            ((received_byte >= UART_FRAME_CMD_RANGE2_START) && (received_byte <= UART_FRAME_CMD_RANGE2_END)))
+        if (UartFrame_IsCommandValid(received_byte))
         {
             p_rx_frame->cmd = (enum UartFrameCmd)received_byte;
-            frame_byte_cnt++;
+            FrameCrc        = Checksum_UpdateCRC16(received_byte, FrameCrc);
+            FrameByteCnt++;
             return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
         }
 
-        frame_byte_cnt = 0;
+        UartFrame_Resync(received_byte, p_rx_frame);
+        FrameByteCnt = 0;
         return UART_FRAME_STATUS_COMMAND_ERROR;
     }
 
-    if (frame_byte_cnt < (p_rx_frame->len + UART_FRAME_PAYLOAD_OFFSET))
+    if (FrameByteCnt < (p_rx_frame->len + UART_FRAME_PAYLOAD_OFFSET))
     {
-        p_rx_frame->p_payload[frame_byte_cnt - UART_FRAME_PAYLOAD_OFFSET] = received_byte;
-        frame_byte_cnt++;
+        p_rx_frame->p_payload[FrameByteCnt - UART_FRAME_PAYLOAD_OFFSET] = received_byte;
+        FrameCrc                                                        = Checksum_UpdateCRC16(received_byte, FrameCrc);
+        FrameByteCnt++;
         return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
     }
 
-    if (frame_byte_cnt == UART_FRAME_CRC_BYTE_1_OFFSET(p_rx_frame->len))
+    if (FrameByteCnt == UART_FRAME_CRC_BYTE_1_OFFSET(p_rx_frame->len))
     {
-        crc = received_byte;
-        frame_byte_cnt++;
+        FrameReceivedCrc = received_byte;
+        FrameByteCnt++;
         return UART_FRAME_STATUS_PROCESSING_NO_ERROR;
     }
 
-    if (frame_byte_cnt == UART_FRAME_CRC_BYTE_2_OFFSET(p_rx_frame->len))
+    if (FrameByteCnt == UART_FRAME_CRC_BYTE_2_OFFSET(p_rx_frame->len))
     {
-        crc += ((uint16_t)received_byte) << 8;
-        if (crc == UartFrame_CalculateCrc16(p_rx_frame->len, p_rx_frame->cmd, p_rx_frame->p_payload))
+        // CRC is updated with every received byte, so the frame is verified without a second pass over the payload
+        FrameReceivedCrc += ((uint16_t)received_byte) << 8;
+        if (FrameReceivedCrc == FrameCrc)
         {
-            frame_byte_cnt = 0;
+            FrameByteCnt = 0;
             return UART_FRAME_STATUS_FRAME_READY;
         }
 
-        frame_byte_cnt = 0;
+        UartFrame_Resync(received_byte, p_rx_frame);
+        FrameByteCnt = 0;
         return UART_FRAME_STATUS_CRC_ERROR;
     }
 
     // We should never reach this point
     ASSERT(false);
 
-    frame_byte_cnt = 0;
+    FrameByteCnt = 0;
     return UART_FRAME_STATUS_ERROR_UNKNOWN;
 }
 
+static void UartFrame_Resync(uint8_t received_byte, struct UartFrameRxTxFrame *p_rx_frame)
+{
+    // The first preamble byte is skipped, as the frame starting with it is invalid
+    uint8_t frame_bytes_cnt = FrameByteCnt;
+    uint8_t pending_cnt     = ResyncLen - ResyncIdx;
+    uint8_t i               = 0;
+
+    // Bytes which are not decoded yet follow the bytes of the invalid frame
+    memmove(&ResyncBytes[frame_bytes_cnt], &ResyncBytes[ResyncIdx], pending_cnt);
+
+    // Bytes of the invalid frame are restored from the decoder state, so valid frames are not copied
+    if (FrameByteCnt > UART_FRAME_PREAMBLE_BYTE_2_OFFSET)
+    {
+        ResyncBytes[i++] = UART_FRAME_PREAMBLE_BYTE_2;
+    }
+
+    if (FrameByteCnt > UART_FRAME_LEN_OFFSET)
+    {
+        ResyncBytes[i++] = p_rx_frame->len;
+    }
+
+    if (FrameByteCnt > UART_FRAME_CMD_OFFSET)
+    {
+        ResyncBytes[i++] = (uint8_t)p_rx_frame->cmd;
+    }
+
+    if (FrameByteCnt > UART_FRAME_CRC_BYTE_1_OFFSET(p_rx_frame->len))
+    {
+        memcpy(&ResyncBytes[i], p_rx_frame->p_payload, p_rx_frame->len);
+        i += p_rx_frame->len;
+        ResyncBytes[i++] = LOW_BYTE(FrameReceivedCrc);
+    }
+
+    ResyncBytes[i++] = received_byte;
+
+    ASSERT(i == frame_bytes_cnt);
+
+    ResyncLen = frame_bytes_cnt + pending_cnt;
+
+    // Bytes before the next preamble cannot start a frame
+    uint8_t *p_preamble = memchr(ResyncBytes, UART_FRAME_PREAMBLE_BYTE_1, ResyncLen);
+    ResyncIdx           = (p_preamble != NULL) ? (uint8_t)(p_preamble - ResyncBytes) : ResyncLen;
+}
+
 static uint16_t UartFrame_CalculateCrc16(uint8_t len, uint8_t cmd, uint8_t *p_data)
 {
     uint16_t crc = UART_FRAME_CRC16_INIT_VAL;
@@ -231,3 +629,88 @@ static uint16_t UartFrame_CalculateCrc16(uint8_t len, uint8_t cmd, uint8_t *p_da
     crc          = Checksum_CalcCRC16(p_data, len, crc);
     return crc;
 }
+
+static bool UartFrame_Transmit(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt, uint16_t crc)
+{
+    struct UartHalTxReservation reservation;
+    size_t                      tx_offset = 0;
+    uint8_t                     len       = 0;
+    uint8_t                     header[UART_FRAME_HEADER_LEN];
+    uint8_t                     crc_bytes[UART_FRAME_CRC_LEN];
+    size_t                      i;
+
+    for (i = 0; i < segments_cnt; i++)
+    {
+        len += p_segments[i].len;
+    }
+
+    ASSERT((len <= UART_FRAME_MAX_PAYLOAD_LEN) && (((cmd >= UART_FRAME_CMD_RANGE1_START) && (cmd <= UART_FRAME_CMD_RANGE1_END)) ||
+                                                   ((cmd >= UART_FRAME_CMD_RANGE2_START) && (cmd <= UART_FRAME_CMD_RANGE2_END))));
+
+    // Frame is written directly to the TX DMA buffer
+    if (!UartHal_TxReserve(UART_FRAME_FRAME_LEN(len), UartFrame_GetTxPriority(cmd), &reservation))
+    {
+        return false;
+    }
+
+    header[UART_FRAME_PREAMBLE_BYTE_1_OFFSET] = UART_FRAME_PREAMBLE_BYTE_1;
+    header[UART_FRAME_PREAMBLE_BYTE_2_OFFSET] = UART_FRAME_PREAMBLE_BYTE_2;
+    header[UART_FRAME_LEN_OFFSET]             = len;
+    header[UART_FRAME_CMD_OFFSET]             = cmd;
+
+    crc_bytes[0] = LOW_BYTE(crc);
+    crc_bytes[1] = HIGH_BYTE(crc);
+
+    UartFrame_WriteTx(&reservation, &tx_offset, header, sizeof(header));
+
+    for (i = 0; i < segments_cnt; i++)
+    {
+        UartFrame_WriteTx(&reservation, &tx_offset, p_segments[i].p_data, p_segments[i].len);
+    }
+
+    UartFrame_WriteTx(&reservation, &tx_offset, crc_bytes, sizeof(crc_bytes));
+
+    UartHal_TxCommit(&reservation);
+
+    TxFramesCnt++;
+
+#if UART_FRAME_LOGGER_ENABLE
+    LOG_D("Frame sent: len: %u, cmd: 0x%02X", len, cmd);
+    for (i = 0; i < segments_cnt; i++)
+    {
+        LOG_HEX_D("Payload:", p_segments[i].p_data, p_segments[i].len);
+    }
+#endif
+
+    return true;
+}
+
+static void UartFrame_WriteTx(struct UartHalTxReservation *p_reservation, size_t *p_offset, uint8_t *p_data, size_t len)
+{
+    // Reserved space can wrap around the end of the TX buffer, so data is written span by span
+    size_t span_offset = *p_offset;
+    size_t i;
+
+    *p_offset += len;
+
+    for (i = 0; (i < RING_BUFFER_SPANS_CNT) && (len != 0); i++)
+    {
+        struct RingBufferSpan *p_span = &p_reservation->spans[i];
+        if (span_offset >= p_span->len)
+        {
+            span_offset -= p_span->len;
+            continue;
+        }
+
+        size_t cpy_len = p_span->len - span_offset;
+        if (cpy_len > len)
+        {
+            cpy_len = len;
+        }
+
+        memcpy(&p_span->p_buf[span_offset], p_data, cpy_len);
+        p_data += cpy_len;
+        len -= cpy_len;
+        span_offset = 0;
+    }
+}
@@ -2,12 +2,18 @@
 #define UART_FRAME_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "Utils.h"
 
 #define UART_FRAME_LOGGER_ENABLE 0
 
+#define UART_FRAME_BULK_DECODE_ENABLE 1
+
+// Sample the clock tick when a received frame is decoded, required by UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+#define UART_FRAME_READY_TICK_ENABLE 0
+
 #define UART_FRAME_MAX_PAYLOAD_LEN 127
 
 enum UartFrameCmd
@@ -61,7 +67,15 @@ enum UartFrameCmd
     UART_FRAME_CMD_TIME_SOURCE_GET_RESP            = 0x2C,
     UART_FRAME_CMD_TIME_GET_REQ                    = 0x2D,
     UART_FRAME_CMD_TIME_GET_RESP                   = 0x2E,
-    UART_FRAME_CMD_RANGE1_END                      = 0x2E,
+    UART_FRAME_CMD_BAUDRATE_SET_REQ                = 0x2F,
+    UART_FRAME_CMD_BAUDRATE_SET_RESP               = 0x30,
+    UART_FRAME_CMD_RX_STATS_REQ                    = 0x31,
+    UART_FRAME_CMD_RX_STATS_RESP                   = 0x32,
+    UART_FRAME_CMD_TX_STATS_REQ                    = 0x33,
+    UART_FRAME_CMD_TX_STATS_RESP                   = 0x34,
+    UART_FRAME_CMD_HANDLER_STATS_REQ               = 0x35,
+    UART_FRAME_CMD_HANDLER_STATS_RESP              = 0x36,
+    UART_FRAME_CMD_RANGE1_END                      = 0x36,
 
     // Second, DFU range of UART frame commands
     UART_FRAME_CMD_RANGE2_START         = 0x80,
@@ -99,16 +113,142 @@ struct PACKED UartFrameRxTxFrame
     uint8_t           p_payload[UART_FRAME_MAX_PAYLOAD_LEN];
 };
 
+// Part of the frame payload, used to send data without concatenating it first
+struct UartFrameSegment
+{
+    uint8_t *p_data;
+    uint8_t  len;
+};
+
+struct UartFrameRxStats
+{
+    uint32_t bytes_cnt;              /**< Bytes received */
+    uint32_t frames_cnt;             /**< Correctly decoded frames */
+    uint32_t crc_errors_cnt;         /**< Frames dropped because of CRC mismatch */
+    uint32_t preamble_errors_cnt;    /**< Frames dropped because of invalid second preamble byte */
+    uint32_t length_errors_cnt;      /**< Frames dropped because of too long payload */
+    uint32_t command_errors_cnt;     /**< Frames dropped because of unknown command */
+    uint32_t overruns_cnt;           /**< RX buffer overruns, received data was lost */
+    uint16_t buffer_high_water_mark; /**< The highest number of unread bytes in the RX buffer */
+    uint16_t buffer_len;             /**< RX buffer size */
+};
+
+struct UartFrameTxStats
+{
+    uint32_t frames_cnt;        /**< Frames queued for transmission */
+    uint32_t dma_transfers_cnt; /**< TX DMA transfers, with TX coalescing a single transfer sends multiple frames */
+};
+
+/*
+ *  Handler of frames decoded by UartFrame_ProcessIncomingDataBulk
+ *
+ *  @param p_rx_frame   Decoded frame
+ *  @return             False to stop decoding, data following the frame is left in the RX buffer
+ */
+typedef bool (*UartFrameRxFrameHandler_T)(struct UartFrameRxTxFrame *p_rx_frame);
+
 void UartFrame_Init(void);
 
 bool UartFrame_IsInitialized(void);
 
 bool UartFrame_ProcessIncomingData(struct UartFrameRxTxFrame *p_rx_frame);
 
+/*
+ *  Decode all frames available in the RX buffer and pass each of them to the handler,
+ *  until the buffer is empty or the handler stops decoding
+ *
+ *  @param p_rx_frame       Frame buffer, reused for each decoded frame
+ *  @param p_frame_handler  Handler called for every complete frame
+ *  @return                 Number of decoded frames
+ */
+size_t UartFrame_ProcessIncomingDataBulk(struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler);
+
 void UartFrame_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len);
 
+/*
+ *  Send frame with payload made of consecutive segments
+ *
+ *  @param cmd              Frame command
+ *  @param p_segments       Payload segments
+ *  @param segments_cnt     Number of payload segments
+ */
+void UartFrame_SendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt);
+
+/*
+ *  Send frame if there is space in the TX buffer. Unlike UartFrame_Send, full TX buffer is not an error.
+ *
+ *  @param cmd              Frame command
+ *  @param p_payload        Frame payload
+ *  @param len              Payload length
+ *  @return                 False if TX buffer is full and the frame has not been sent
+ */
+bool UartFrame_TrySend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len);
+
+/*
+ *  Send frame with payload made of consecutive segments if there is space in the TX buffer
+ *
+ *  @param cmd              Frame command
+ *  @param p_segments       Payload segments
+ *  @param segments_cnt     Number of payload segments
+ *  @return                 False if TX buffer is full or payload is too long and the frame has not been sent
+ */
+bool UartFrame_TrySendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt);
+
+/*
+ *  Check if frame can be sent without waiting for TX buffer space. Frames with different commands
+ *  can be queued in TX buffers of different priority.
+ *
+ *  @param cmd              Frame command
+ *  @param len              Payload length
+ *  @return                 True if the frame fits in the TX buffer
+ */
+bool UartFrame_IsTxSpaceAvailable(enum UartFrameCmd cmd, uint8_t len);
+
 void UartFrame_Flush(void);
 
+void UartFrame_SetBaudrate(uint32_t baudrate);
+
+uint32_t UartFrame_GetBaudrate(void);
+
+bool UartFrame_IsRxDataAvailable(void);
+
+/*
+ *  Set callback notifying about received data, called from interrupt context
+ *
+ *  @param p_callback       RX data callback, NULL to disable notifications
+ */
+void UartFrame_SetRxDataCallback(void (*p_callback)(void));
+
+/*
+ *  Get RX statistics collected since initialization or the last UartFrame_ClearRxStats call
+ *
+ *  @param p_stats          [out] RX statistics
+ */
+void UartFrame_GetRxStats(struct UartFrameRxStats *p_stats);
+
+void UartFrame_ClearRxStats(void);
+
+/*
+ *  Enable TX coalescing, frames are sent by UartFrame_ProcessPendingTx instead of starting DMA transfer for each of them
+ *
+ *  @param is_enable        True to enable coalescing
+ *  @param window_us        Minimal time between the first pending frame and the transfer start
+ */
+void UartFrame_SetTxCoalescing(bool is_enable, uint32_t window_us);
+
+void UartFrame_ProcessPendingTx(void);
+
+void UartFrame_GetTxStats(struct UartFrameTxStats *p_stats);
+
+#if UART_FRAME_READY_TICK_ENABLE
+/*
+ *  Get clock tick sampled when the last received frame was decoded, before it was returned or passed to the handler
+ *
+ *  @return                 TickHal_GetClockTick value
+ */
+uint32_t UartFrame_GetFrameReadyTick(void);
+#endif
+
 STATIC_ASSERT(sizeof(struct UartFrameRxTxFrame) == 129, Wrong_size_of_the_struct_UartFrameRxFrame);
 
 #endif
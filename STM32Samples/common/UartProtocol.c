@@ -1,19 +1,25 @@
 #include "UartProtocol.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "Assert.h"
 #include "Log.h"
 #include "Mesh.h"
 #include "SimpleScheduler.h"
+#include "Startup.h"
+#include "TickHal.h"
 #include "Timestamp.h"
 #include "Utils.h"
 
 #define UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS 150
 
 #define UART_PROTOCOL_TASK_PERIOD_MS 0
+#define UART_PROTOCOL_REQUESTS_TASK_PERIOD_MS 10
 
 #define UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS 16
+#define UART_PROTOCOL_MAX_NUMBER_OF_MESH_OPCODES 32
+#define UART_PROTOCOL_MAX_NUMBER_OF_TX_SPACE_CALLBACKS 4
 
 #define UART_PROTOCOL_INVALID_MESH_OPCODE 0
 #define UART_PROTOCOL_CMD_AND_LEN_SIZE 2
@@ -23,17 +29,116 @@
 #define UART_PROTOCOL_MESH_OPCODE_SIZE_RFU_MASK 0x7F
 #define UART_PROTOCOL_MESH_OPCODE_SIZE_1_OCTET_MASK 0x00
 
+#define UART_PROTOCOL_CMD_RANGE1_CNT (UART_FRAME_CMD_RANGE1_END - UART_FRAME_CMD_RANGE1_START + 1)
+#define UART_PROTOCOL_CMD_RANGE2_CNT (UART_FRAME_CMD_RANGE2_END - UART_FRAME_CMD_RANGE2_START + 1)
+#define UART_PROTOCOL_CMD_CNT (UART_PROTOCOL_CMD_RANGE1_CNT + UART_PROTOCOL_CMD_RANGE2_CNT)
+#define UART_PROTOCOL_INVALID_CMD_INDEX UINT8_MAX
+
+// Bit mask of HandlerConfig indices
+typedef uint16_t UartProtocolHandlerMask_T;
+
+STATIC_ASSERT(UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS <= sizeof(UartProtocolHandlerMask_T) * 8, Too_many_handlers_for_the_handler_mask);
+
+// Mesh opcode index entry holds the opcode in the upper 3 bytes and HandlerConfig index in the lowest byte
+#define UART_PROTOCOL_MESH_OPCODE_MAX 0xFFFFFF
+#define UART_PROTOCOL_MESH_OPCODE_ENTRY(opcode, handler_idx) (((uint32_t)(opcode) << 8) | (handler_idx))
+#define UART_PROTOCOL_MESH_OPCODE_ENTRY_OPCODE(entry) ((entry) >> 8)
+#define UART_PROTOCOL_MESH_OPCODE_ENTRY_HANDLER_IDX(entry) ((entry)&0xFF)
+
+struct UartProtocolRequest
+{
+    const struct UartProtocolRequestConfig *p_config;
+
+    uint32_t sent_timestamp;
+    uint8_t  p_payload[UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN];
+
+    enum UartFrameCmd cmd;
+    uint8_t           instance_index;
+    uint8_t           len;
+    uint8_t           retry;
+};
+
 static bool IsInitialized = false;
 
 static struct UartProtocolHandlerConfig *HandlerConfig[UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS];
 static uint8_t                           HandlerConfigCnt = 0;
 
+// Handlers of every UART command, built at registration, so the frame is dispatched with a single lookup
+static UartProtocolHandlerMask_T CommandHandlers[UART_PROTOCOL_CMD_CNT];
+
+// Opcodes of all mesh message handlers, sorted by opcode and then by the order of registration, searched with binary search
+static uint32_t MeshOpcodeIndex[UART_PROTOCOL_MAX_NUMBER_OF_MESH_OPCODES];
+static uint8_t  MeshOpcodeIndexCnt = 0;
+
+static UartProtocolTxSpaceCallback_T TxSpaceCallback[UART_PROTOCOL_MAX_NUMBER_OF_TX_SPACE_CALLBACKS];
+static uint8_t                       TxSpaceCallbackCnt = 0;
+
+// The last frame which did not fit in the TX buffer
+static enum UartFrameCmd TxBlockedCmd = UART_FRAME_CMD_PROHIBITED;
+static uint8_t           TxBlockedLen = 0;
+
+static uint32_t RxBudgetStartTick = 0;
+
+// Requests waiting for a response, in the order of sending
+static struct UartProtocolRequest Requests[UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS];
+static uint8_t                    RequestsCnt = 0;
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static struct UartProtocolHandlerStats HandlerStats[UART_PROTOCOL_HANDLER_PROFILING_MAX_ENTRIES];
+static uint8_t                         HandlerStatsCnt = 0;
+#endif
+
+static bool UartProtocol_StartFrames(void);
+
+static const struct StartupStep StartupSteps[] = {
+    // UART is started when the modem frame timeout elapses, so the frame interrupted by the MCU reset is dropped by the modem
+    {NULL, UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS},
+
+    // This delay is added just to keep consistent behavior of older and current MCU FW versions.
+    // Older MCU FW versions had delay at startup equal to 1000 ms for uart protocol timeout.
+    // Please remove this delay after task SP-10932 is closed.
+    {UartProtocol_StartFrames, 1000 - UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS},
+};
+
+static const struct StartupSequence StartupSequence = {
+    .p_name    = "UartProtocol",
+    .p_steps   = StartupSteps,
+    .steps_cnt = ARRAY_SIZE(StartupSteps),
+};
+
 static void    UartProtocol_ProcessIncomingData(void);
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+static void    UartProtocol_RxDataEvent(void);
+#endif
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+static void    UartProtocol_ProcessPendingTx(void);
+#endif
+static void    UartProtocol_ProcessTxSpace(void);
+static void    UartProtocol_SetTxBlocked(enum UartFrameCmd cmd, uint8_t len);
+static void    UartProtocol_ProcessRequests(void);
+static size_t  UartProtocol_FindRequest(enum UartFrameCmd cmd, uint8_t instance_index);
+static bool    UartProtocol_IsSameRequest(struct UartProtocolRequest *p_request, enum UartFrameCmd cmd, uint8_t instance_index, uint8_t *p_payload, uint8_t len);
+static void    UartProtocol_RemoveRequest(size_t request_idx);
+static void    UartProtocol_CompleteRequest(struct UartFrameRxTxFrame *p_rx_frame, uint8_t instance_index);
+static bool    UartProtocol_IsRxBudgetExceeded(void);
+#if UART_FRAME_BULK_DECODE_ENABLE
+static bool    UartProtocol_ProcessFrame(struct UartFrameRxTxFrame *p_rx_frame);
+#endif
+static void    UartProtocol_DispatchFrame(struct UartFrameRxTxFrame *p_rx_frame);
 static bool    UartProtocol_ParseMeshMessageRequest(struct UartFrameRxTxFrame *p_rx_frame, struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame);
 static uint8_t UartProtocol_CheckIfInstanceIndexExist(struct UartFrameRxTxFrame *p_rx_frame);
-static void    UartProtocol_CallAllUartCommandHandlers(struct UartProtocolHandlerConfig *p_handler_config_row, struct UartFrameRxTxFrame *p_rx_frame);
-static void    UartProtocol_CallAllMeshHandlers(struct UartProtocolHandlerConfig         *p_handler_config_row,
-                                                struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame);
+static uint8_t UartProtocol_GetCommandIndex(enum UartFrameCmd cmd);
+static bool    UartProtocol_IsInstanceIndexMatch(struct UartProtocolHandlerConfig *p_handler_config_row, uint8_t instance_index);
+static void    UartProtocol_CallAllUartCommandHandlers(struct UartFrameRxTxFrame *p_rx_frame, uint8_t instance_index);
+static void    UartProtocol_AddMeshOpcode(uint32_t opcode, uint8_t handler_idx);
+static size_t  UartProtocol_FindMeshOpcode(uint32_t opcode);
+static void    UartProtocol_CallAllMeshHandlers(struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame);
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void                             UartProtocol_AddHandlerStats(enum UartFrameCmd cmd, uint32_t mesh_opcode, uint32_t handlers_start_tick);
+static struct UartProtocolHandlerStats *UartProtocol_FindHandlerStats(enum UartFrameCmd cmd, uint32_t mesh_opcode);
+static void                             UartProtocol_AddTicks(struct UartProtocolTicksStats *p_stats, uint32_t ticks);
+static uint32_t                         UartProtocol_GetMeanTicks(const struct UartProtocolTicksStats *p_stats);
+#endif
 
 void UartProtocol_Init(void)
 {
@@ -41,19 +146,20 @@ void UartProtocol_Init(void)
 
     LOG_D("UartProtocol initialization");
 
-    Timestamp_DelayMs(UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS);
+    // Enabled when UART frames are started, after the startup delay
+    SimpleScheduler_TaskAdd(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessIncomingData, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, false);
 
-    // This delay is added just to keep consistent behavior of older and current MCU FW versions.
-    // Older MCU FW versions had delay at startup equal to 1000 ms for uart protocol timeout.
-    // Please remove this delay after task SP-10932 is closed.
-    Timestamp_DelayMs(1000 - UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS);
+    // Enabled only when a frame does not fit in the TX buffer
+    SimpleScheduler_TaskAdd(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessTxSpace, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, false);
 
-    if (!UartFrame_IsInitialized())
-    {
-        UartFrame_Init();
-    }
+    // Enabled only when a request waits for a response
+    SimpleScheduler_TaskAdd(UART_PROTOCOL_REQUESTS_TASK_PERIOD_MS, UartProtocol_ProcessRequests, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, false);
+
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+    SimpleScheduler_TaskAdd(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessPendingTx, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX, true);
+#endif
 
-    SimpleScheduler_TaskAdd(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessIncomingData, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+    Startup_AddSequence(&StartupSequence);
 
     IsInitialized = true;
 }
@@ -67,6 +173,28 @@ void UartProtocol_RegisterMessageHandler(struct UartProtocolHandlerConfig *p_con
 {
     ASSERT((p_config != NULL) && (HandlerConfigCnt < UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS));
 
+    if ((p_config->p_uart_frame_command_list != NULL) && (p_config->p_uart_message_handler != NULL))
+    {
+        size_t i;
+        for (i = 0; i < p_config->uart_frame_command_list_len; i++)
+        {
+            uint8_t cmd_index = UartProtocol_GetCommandIndex(p_config->p_uart_frame_command_list[i]);
+
+            ASSERT(cmd_index != UART_PROTOCOL_INVALID_CMD_INDEX);
+
+            CommandHandlers[cmd_index] |= (UartProtocolHandlerMask_T)1 << HandlerConfigCnt;
+        }
+    }
+
+    if ((p_config->p_mesh_message_opcode_list != NULL) && (p_config->p_mesh_message_handler != NULL))
+    {
+        size_t i;
+        for (i = 0; i < p_config->mesh_message_opcode_list_len; i++)
+        {
+            UartProtocol_AddMeshOpcode(p_config->p_mesh_message_opcode_list[i], HandlerConfigCnt);
+        }
+    }
+
     HandlerConfig[HandlerConfigCnt] = p_config;
     HandlerConfigCnt++;
 }
@@ -76,6 +204,11 @@ void UartProtocol_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
     UartFrame_Send(cmd, p_payload, len);
 }
 
+void UartProtocol_SendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    UartFrame_SendV(cmd, p_segments, segments_cnt);
+}
+
 void UartProtocol_SendFrame(struct UartFrameRxTxFrame *p_frame)
 {
     ASSERT(p_frame != NULL);
@@ -83,45 +216,442 @@ void UartProtocol_SendFrame(struct UartFrameRxTxFrame *p_frame)
     UartFrame_Send(p_frame->cmd, p_frame->p_payload, p_frame->len);
 }
 
+void UartProtocol_SendRequest(const struct UartProtocolRequestConfig *p_config, enum UartFrameCmd cmd, uint8_t instance_index, uint8_t *p_payload, uint8_t len)
+{
+    ASSERT((p_config != NULL) && ((p_config->retries_cnt == 0) || (len <= UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN)));
+
+    size_t request_idx;
+    for (request_idx = 0; request_idx < RequestsCnt; request_idx++)
+    {
+        if (UartProtocol_IsSameRequest(&Requests[request_idx], cmd, instance_index, p_payload, len))
+        {
+            break;
+        }
+    }
+
+    UartProtocolTimeoutCallback_T p_evicted_timeout_callback = NULL;
+    enum UartFrameCmd             evicted_cmd                = UART_FRAME_CMD_PING_REQUEST;
+    uint8_t                       evicted_instance_index     = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN;
+
+    if (request_idx == RequestsCnt)
+    {
+        if (RequestsCnt == UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS)
+        {
+            // Modem does not respond - the oldest request is dropped as if it timed out, so the new one is still sent
+            LOG_W("Request 0x%02X dropped, instance index %d", Requests[0].cmd, Requests[0].instance_index);
+
+            p_evicted_timeout_callback = Requests[0].p_config->p_timeout_callback;
+            evicted_cmd                = Requests[0].cmd;
+            evicted_instance_index     = Requests[0].instance_index;
+
+            UartProtocol_RemoveRequest(0);
+        }
+
+        request_idx = RequestsCnt;
+        RequestsCnt++;
+    }
+
+    struct UartProtocolRequest *p_request = &Requests[request_idx];
+
+    p_request->p_config       = p_config;
+    p_request->cmd            = cmd;
+    p_request->instance_index = instance_index;
+    p_request->len            = len;
+    p_request->retry          = 0;
+    p_request->sent_timestamp = Timestamp_GetCurrent();
+
+    // Payload is needed to send the request again and to recognize the same request
+    if ((len != 0) && (len <= UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN))
+    {
+        memcpy(p_request->p_payload, p_payload, len);
+    }
+
+    UartProtocol_Send(cmd, p_payload, len);
+
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, true);
+
+    // Called last, so the callback can send the dropped request again
+    if (p_evicted_timeout_callback != NULL)
+    {
+        p_evicted_timeout_callback(evicted_cmd, evicted_instance_index);
+    }
+}
+
+bool UartProtocol_IsRequestPending(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    return UartProtocol_FindRequest(cmd, instance_index) < RequestsCnt;
+}
+
+bool UartProtocol_TrySend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    if (!UartFrame_TrySend(cmd, p_payload, len))
+    {
+        UartProtocol_SetTxBlocked(cmd, len);
+        return false;
+    }
+
+    return true;
+}
+
+bool UartProtocol_TrySendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    if (!UartFrame_TrySendV(cmd, p_segments, segments_cnt))
+    {
+        size_t len = 0;
+        size_t i;
+        for (i = 0; i < segments_cnt; i++)
+        {
+            len += p_segments[i].len;
+        }
+
+        // Too long payload is never sent, so there is no TX space to wait for
+        if (len <= UART_FRAME_MAX_PAYLOAD_LEN)
+        {
+            UartProtocol_SetTxBlocked(cmd, len);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+bool UartProtocol_IsTxSpaceAvailable(enum UartFrameCmd cmd, uint8_t len)
+{
+    return UartFrame_IsTxSpaceAvailable(cmd, len);
+}
+
+void UartProtocol_RegisterTxSpaceCallback(UartProtocolTxSpaceCallback_T p_callback)
+{
+    ASSERT((p_callback != NULL) && (TxSpaceCallbackCnt < UART_PROTOCOL_MAX_NUMBER_OF_TX_SPACE_CALLBACKS));
+
+    TxSpaceCallback[TxSpaceCallbackCnt] = p_callback;
+    TxSpaceCallbackCnt++;
+}
+
 void UartProtocol_Flush(void)
 {
     UartFrame_Flush();
 }
 
+void UartProtocol_SetBaudrate(uint32_t baudrate)
+{
+    UartFrame_SetBaudrate(baudrate);
+}
+
+uint32_t UartProtocol_GetBaudrate(void)
+{
+    return UartFrame_GetBaudrate();
+}
+
+void UartProtocol_GetRxStats(struct UartFrameRxStats *p_stats)
+{
+    UartFrame_GetRxStats(p_stats);
+}
+
+void UartProtocol_ClearRxStats(void)
+{
+    UartFrame_ClearRxStats();
+}
+
+void UartProtocol_GetTxStats(struct UartFrameTxStats *p_stats)
+{
+    UartFrame_GetTxStats(p_stats);
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+bool UartProtocol_GetHandlerStats(uint8_t entry_index, struct UartProtocolHandlerStats *p_stats)
+{
+    ASSERT(p_stats != NULL);
+
+    if (entry_index >= HandlerStatsCnt)
+    {
+        return false;
+    }
+
+    *p_stats = HandlerStats[entry_index];
+
+    return true;
+}
+
+uint8_t UartProtocol_GetHandlerStatsCnt(void)
+{
+    return HandlerStatsCnt;
+}
+
+void UartProtocol_ClearHandlerStats(void)
+{
+    HandlerStatsCnt = 0;
+}
+
+void UartProtocol_LogHandlerStats(void)
+{
+    LOG_D("Handler profile, clock ticks min/max/mean:");
+
+    size_t i;
+    for (i = 0; i < HandlerStatsCnt; i++)
+    {
+        struct UartProtocolHandlerStats *p_stats = &HandlerStats[i];
+
+        if (p_stats->mesh_opcode == UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE)
+        {
+            LOG_D("  Command 0x%02X", p_stats->cmd);
+        }
+        else
+        {
+            LOG_D("  Command 0x%02X, mesh opcode 0x%06lX", p_stats->cmd, (unsigned long)p_stats->mesh_opcode);
+        }
+
+        LOG_D("    Calls: %lu, handler: %lu/%lu/%lu, latency: %lu/%lu/%lu",
+              (unsigned long)p_stats->handler.cnt,
+              (unsigned long)p_stats->handler.min,
+              (unsigned long)p_stats->handler.max,
+              (unsigned long)UartProtocol_GetMeanTicks(&p_stats->handler),
+              (unsigned long)p_stats->latency.min,
+              (unsigned long)p_stats->latency.max,
+              (unsigned long)UartProtocol_GetMeanTicks(&p_stats->latency));
+    }
+}
+#endif
+
+static bool UartProtocol_StartFrames(void)
+{
+    if (!UartFrame_IsInitialized())
+    {
+        UartFrame_Init();
+    }
+
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+    UartFrame_SetRxDataCallback(UartProtocol_RxDataEvent);
+#endif
+
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+    UartFrame_SetTxCoalescing(true, UART_PROTOCOL_TX_COALESCING_WINDOW_US);
+#endif
+
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+
+    return true;
+}
+
 static void UartProtocol_ProcessIncomingData(void)
 {
     // This structure must be aligned to avoid pointer misalignment after casting
     static struct UartFrameRxTxFrame rx_frame ALIGN(4);
 
-    if (!UartFrame_ProcessIncomingData(&rx_frame))
+    RxBudgetStartTick = TickHal_GetClockTick();
+
+#if UART_FRAME_BULK_DECODE_ENABLE
+    UartFrame_ProcessIncomingDataBulk(&rx_frame, UartProtocol_ProcessFrame);
+#else
+    while (UartFrame_IsRxDataAvailable())
     {
-        return;
+        if (UartFrame_ProcessIncomingData(&rx_frame))
+        {
+            UartProtocol_DispatchFrame(&rx_frame);
+
+            if (UartProtocol_IsRxBudgetExceeded())
+            {
+                break;
+            }
+        }
     }
+#endif
 
-    uint8_t instance_index = UartProtocol_CheckIfInstanceIndexExist(&rx_frame);
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+    // Task is disabled before the check, so data received in the meantime enables it again from the RX data event
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, false);
 
-    struct UartProtocolFrameMeshMessageFrame mesh_message_frame = {0};
+    if (UartFrame_IsRxDataAvailable())
+    {
+        SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+    }
+#endif
+}
 
-    bool is_mesh_message_frame_valid = UartProtocol_ParseMeshMessageRequest(&rx_frame, &mesh_message_frame);
+static void UartProtocol_ProcessRequests(void)
+{
+    uint32_t current_time = Timestamp_GetCurrent();
 
-    size_t i;
-    for (i = 0; i < HandlerConfigCnt; i++)
+    size_t i = 0;
+    while (i < RequestsCnt)
     {
-        // Filter instance index only if configured instance index is known
-        if ((HandlerConfig[i]->instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) && (instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) &&
-            (HandlerConfig[i]->instance_index != instance_index))
+        struct UartProtocolRequest             *p_request = &Requests[i];
+        const struct UartProtocolRequestConfig *p_config  = p_request->p_config;
+
+        // Exponential backoff - every retry waits twice as long as the previous attempt
+        uint32_t timeout_ms = (uint32_t)p_config->timeout_ms << p_request->retry;
+
+        if (Timestamp_GetTimeElapsed(p_request->sent_timestamp, current_time) < timeout_ms)
         {
+            i++;
             continue;
         }
 
-        if (is_mesh_message_frame_valid)
+        if (p_request->retry < p_config->retries_cnt)
         {
-            UartProtocol_CallAllMeshHandlers(HandlerConfig[i], &mesh_message_frame);
+            // When TX buffer is full, the retry is postponed to the next task run
+            if (UartFrame_TrySend(p_request->cmd, p_request->p_payload, p_request->len))
+            {
+                p_request->retry++;
+                p_request->sent_timestamp = current_time;
+            }
+
+            i++;
             continue;
         }
 
-        UartProtocol_CallAllUartCommandHandlers(HandlerConfig[i], &rx_frame);
+        LOG_W("Request 0x%02X timeout, instance index %d", p_request->cmd, p_request->instance_index);
+
+        enum UartFrameCmd             cmd                = p_request->cmd;
+        uint8_t                       instance_index     = p_request->instance_index;
+        UartProtocolTimeoutCallback_T p_timeout_callback = p_config->p_timeout_callback;
+
+        // Request is removed first, so the callback can send it again
+        UartProtocol_RemoveRequest(i);
+
+        if (p_timeout_callback != NULL)
+        {
+            p_timeout_callback(cmd, instance_index);
+        }
+    }
+
+    if (RequestsCnt == 0)
+    {
+        SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, false);
+    }
+}
+
+static size_t UartProtocol_FindRequest(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    size_t i;
+    for (i = 0; i < RequestsCnt; i++)
+    {
+        if ((Requests[i].cmd == cmd) && (Requests[i].instance_index == instance_index))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+static bool UartProtocol_IsSameRequest(struct UartProtocolRequest *p_request, enum UartFrameCmd cmd, uint8_t instance_index, uint8_t *p_payload, uint8_t len)
+{
+    if ((p_request->cmd != cmd) || (p_request->instance_index != instance_index) || (p_request->len != len))
+    {
+        return false;
     }
+
+    // Payload longer than the request buffer is not stored, such requests are recognized by the command and the instance index
+    return (len == 0) || (len > UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN) || (memcmp(p_request->p_payload, p_payload, len) == 0);
+}
+
+static void UartProtocol_RemoveRequest(size_t request_idx)
+{
+    memmove(&Requests[request_idx], &Requests[request_idx + 1], (RequestsCnt - request_idx - 1) * sizeof(Requests[0]));
+    RequestsCnt--;
+}
+
+static void UartProtocol_CompleteRequest(struct UartFrameRxTxFrame *p_rx_frame, uint8_t instance_index)
+{
+    size_t i;
+    for (i = 0; i < RequestsCnt; i++)
+    {
+        struct UartProtocolRequest *p_request = &Requests[i];
+
+        // The oldest request is completed if the response does not carry instance index
+        if ((p_request->p_config->response_cmd != p_rx_frame->cmd) ||
+            ((p_request->instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) && (instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) &&
+             (p_request->instance_index != instance_index)))
+        {
+            continue;
+        }
+
+        UartProtocolResponseCallback_T p_response_callback = p_request->p_config->p_response_callback;
+
+        UartProtocol_RemoveRequest(i);
+
+        if (p_response_callback != NULL)
+        {
+            p_response_callback(p_rx_frame);
+        }
+
+        return;
+    }
+}
+
+static bool UartProtocol_IsRxBudgetExceeded(void)
+{
+    return (uint32_t)(TickHal_GetClockTick() - RxBudgetStartTick) >= UART_PROTOCOL_RX_BUDGET_CLOCK_TICKS;
+}
+
+#if UART_FRAME_BULK_DECODE_ENABLE
+static bool UartProtocol_ProcessFrame(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UartProtocol_DispatchFrame(p_rx_frame);
+
+    // At least one frame is processed in every task run, even if dispatching alone exceeds the budget
+    return !UartProtocol_IsRxBudgetExceeded();
+}
+#endif
+
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+static void UartProtocol_RxDataEvent(void)
+{
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+}
+#endif
+
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+static void UartProtocol_ProcessPendingTx(void)
+{
+    UartFrame_ProcessPendingTx();
+}
+#endif
+
+static void UartProtocol_ProcessTxSpace(void)
+{
+    if (!UartFrame_IsTxSpaceAvailable(TxBlockedCmd, TxBlockedLen))
+    {
+        return;
+    }
+
+    // Task is disabled before the callbacks, so a frame which does not fit again enables it
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, false);
+
+    size_t i;
+    for (i = 0; i < TxSpaceCallbackCnt; i++)
+    {
+        TxSpaceCallback[i]();
+    }
+}
+
+static void UartProtocol_SetTxBlocked(enum UartFrameCmd cmd, uint8_t len)
+{
+    TxBlockedCmd = cmd;
+    TxBlockedLen = len;
+
+    SimpleScheduler_TaskStateChange(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, true);
+}
+
+static void UartProtocol_DispatchFrame(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    uint8_t instance_index = UartProtocol_CheckIfInstanceIndexExist(p_rx_frame);
+
+    if (RequestsCnt != 0)
+    {
+        UartProtocol_CompleteRequest(p_rx_frame, instance_index);
+    }
+
+    struct UartProtocolFrameMeshMessageFrame mesh_message_frame = {0};
+
+    if (!UartProtocol_ParseMeshMessageRequest(p_rx_frame, &mesh_message_frame))
+    {
+        UartProtocol_CallAllUartCommandHandlers(p_rx_frame, instance_index);
+        return;
+    }
+
+    UartProtocol_CallAllMeshHandlers(&mesh_message_frame);
 }
 
 static bool UartProtocol_ParseMeshMessageRequest(struct UartFrameRxTxFrame *p_rx_frame, struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame)
@@ -242,37 +772,210 @@ static uint8_t UartProtocol_CheckIfInstanceIndexExist(struct UartFrameRxTxFrame
     }
 }
 
-static void UartProtocol_CallAllUartCommandHandlers(struct UartProtocolHandlerConfig *p_handler_config_row, struct UartFrameRxTxFrame *p_rx_frame)
+static uint8_t UartProtocol_GetCommandIndex(enum UartFrameCmd cmd)
 {
-    if ((p_handler_config_row->p_uart_frame_command_list == NULL) || (p_handler_config_row->p_uart_message_handler == NULL))
+    // Both command ranges are packed into one table
+    if ((cmd >= UART_FRAME_CMD_RANGE2_START) && (cmd <= UART_FRAME_CMD_RANGE2_END))
+    {
+        return UART_PROTOCOL_CMD_RANGE1_CNT + (cmd - UART_FRAME_CMD_RANGE2_START);
+    }
+
+    if (cmd <= UART_FRAME_CMD_RANGE1_END)
+    {
+        return cmd - UART_FRAME_CMD_RANGE1_START;
+    }
+
+    return UART_PROTOCOL_INVALID_CMD_INDEX;
+}
+
+static bool UartProtocol_IsInstanceIndexMatch(struct UartProtocolHandlerConfig *p_handler_config_row, uint8_t instance_index)
+{
+    // Filter instance index only if configured instance index is known
+    return (p_handler_config_row->instance_index == UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) || (instance_index == UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) ||
+           (p_handler_config_row->instance_index == instance_index);
+}
+
+static void UartProtocol_CallAllUartCommandHandlers(struct UartFrameRxTxFrame *p_rx_frame, uint8_t instance_index)
+{
+    uint8_t cmd_index = UartProtocol_GetCommandIndex(p_rx_frame->cmd);
+
+    if (cmd_index == UART_PROTOCOL_INVALID_CMD_INDEX)
     {
         return;
     }
 
-    size_t k;
-    for (k = 0; k < p_handler_config_row->uart_frame_command_list_len; k++)
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    uint32_t handlers_start_tick = TickHal_GetClockTick();
+    bool     is_handler_called   = false;
+#endif
+
+    // Handlers are called in the order of registration
+    UartProtocolHandlerMask_T handlers = CommandHandlers[cmd_index];
+    while (handlers != 0)
     {
-        if (p_rx_frame->cmd == p_handler_config_row->p_uart_frame_command_list[k])
+        size_t i = __builtin_ctz(handlers);
+        handlers &= handlers - 1;
+
+        if (UartProtocol_IsInstanceIndexMatch(HandlerConfig[i], instance_index))
         {
-            p_handler_config_row->p_uart_message_handler(p_rx_frame);
+            HandlerConfig[i]->p_uart_message_handler(p_rx_frame);
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+            is_handler_called = true;
+#endif
         }
     }
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    if (is_handler_called)
+    {
+        UartProtocol_AddHandlerStats(p_rx_frame->cmd, UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE, handlers_start_tick);
+    }
+#endif
 }
 
-static void UartProtocol_CallAllMeshHandlers(struct UartProtocolHandlerConfig         *p_handler_config_row,
-                                             struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame)
+static void UartProtocol_AddMeshOpcode(uint32_t opcode, uint8_t handler_idx)
 {
-    if ((p_handler_config_row->p_mesh_message_opcode_list == NULL) || (p_handler_config_row->p_mesh_message_handler == NULL))
+    ASSERT((opcode <= UART_PROTOCOL_MESH_OPCODE_MAX) && (MeshOpcodeIndexCnt < UART_PROTOCOL_MAX_NUMBER_OF_MESH_OPCODES));
+
+    uint32_t entry = UART_PROTOCOL_MESH_OPCODE_ENTRY(opcode, handler_idx);
+
+    // Insertion sort, handlers are registered only at initialization
+    size_t i = MeshOpcodeIndexCnt;
+    while ((i > 0) && (MeshOpcodeIndex[i - 1] > entry))
+    {
+        MeshOpcodeIndex[i] = MeshOpcodeIndex[i - 1];
+        i--;
+    }
+
+    MeshOpcodeIndex[i] = entry;
+    MeshOpcodeIndexCnt++;
+}
+
+static size_t UartProtocol_FindMeshOpcode(uint32_t opcode)
+{
+    // Lower bound - the first entry with the opcode, or the entry after it if the opcode is not registered
+    uint32_t entry = UART_PROTOCOL_MESH_OPCODE_ENTRY(opcode, 0);
+    size_t   first = 0;
+    size_t   last  = MeshOpcodeIndexCnt;
+
+    while (first < last)
+    {
+        size_t middle = first + (last - first) / 2;
+
+        if (MeshOpcodeIndex[middle] < entry)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return first;
+}
+
+static void UartProtocol_CallAllMeshHandlers(struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame)
+{
+    if (p_mesh_message_frame->mesh_opcode > UART_PROTOCOL_MESH_OPCODE_MAX)
     {
         return;
     }
 
-    size_t k;
-    for (k = 0; k < p_handler_config_row->mesh_message_opcode_list_len; k++)
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    uint32_t handlers_start_tick = TickHal_GetClockTick();
+    bool     is_handler_called   = false;
+#endif
+
+    // Handlers of the same opcode are sorted in the order of registration
+    size_t i;
+    for (i = UartProtocol_FindMeshOpcode(p_mesh_message_frame->mesh_opcode);
+         (i < MeshOpcodeIndexCnt) && (UART_PROTOCOL_MESH_OPCODE_ENTRY_OPCODE(MeshOpcodeIndex[i]) == p_mesh_message_frame->mesh_opcode);
+         i++)
     {
-        if (p_mesh_message_frame->mesh_opcode == p_handler_config_row->p_mesh_message_opcode_list[k])
+        struct UartProtocolHandlerConfig *p_handler_config_row = HandlerConfig[UART_PROTOCOL_MESH_OPCODE_ENTRY_HANDLER_IDX(MeshOpcodeIndex[i])];
+
+        if (UartProtocol_IsInstanceIndexMatch(p_handler_config_row, p_mesh_message_frame->instance_index))
         {
             p_handler_config_row->p_mesh_message_handler(p_mesh_message_frame);
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+            is_handler_called = true;
+#endif
         }
     }
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    if (is_handler_called)
+    {
+        // Both mesh message request commands are profiled together
+        UartProtocol_AddHandlerStats(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, p_mesh_message_frame->mesh_opcode, handlers_start_tick);
+    }
+#endif
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void UartProtocol_AddHandlerStats(enum UartFrameCmd cmd, uint32_t mesh_opcode, uint32_t handlers_start_tick)
+{
+    uint32_t handlers_end_tick = TickHal_GetClockTick();
+
+    struct UartProtocolHandlerStats *p_stats = UartProtocol_FindHandlerStats(cmd, mesh_opcode);
+
+    if (p_stats == NULL)
+    {
+        return;
+    }
+
+    UartProtocol_AddTicks(&p_stats->handler, handlers_end_tick - handlers_start_tick);
+    // Frame being dispatched is the last one decoded by UartFrame
+    UartProtocol_AddTicks(&p_stats->latency, handlers_start_tick - UartFrame_GetFrameReadyTick());
+}
+
+static struct UartProtocolHandlerStats *UartProtocol_FindHandlerStats(enum UartFrameCmd cmd, uint32_t mesh_opcode)
+{
+    size_t i;
+    for (i = 0; i < HandlerStatsCnt; i++)
+    {
+        if ((HandlerStats[i].cmd == cmd) && (HandlerStats[i].mesh_opcode == mesh_opcode))
+        {
+            return &HandlerStats[i];
+        }
+    }
+
+    if (HandlerStatsCnt == UART_PROTOCOL_HANDLER_PROFILING_MAX_ENTRIES)
+    {
+        return NULL;
+    }
+
+    struct UartProtocolHandlerStats *p_stats = &HandlerStats[HandlerStatsCnt];
+    HandlerStatsCnt++;
+
+    memset(p_stats, 0, sizeof(*p_stats));
+    p_stats->cmd         = cmd;
+    p_stats->mesh_opcode = mesh_opcode;
+
+    return p_stats;
+}
+
+static void UartProtocol_AddTicks(struct UartProtocolTicksStats *p_stats, uint32_t ticks)
+{
+    if ((p_stats->cnt == 0) || (ticks < p_stats->min))
+    {
+        p_stats->min = ticks;
+    }
+
+    if (ticks > p_stats->max)
+    {
+        p_stats->max = ticks;
+    }
+
+    p_stats->sum += ticks;
+    p_stats->cnt++;
+}
+
+static uint32_t UartProtocol_GetMeanTicks(const struct UartProtocolTicksStats *p_stats)
+{
+    return (p_stats->cnt != 0) ? (uint32_t)(p_stats->sum / p_stats->cnt) : 0;
 }
+#endif
@@ -2,6 +2,7 @@
 #define UART_PROTOCOL_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "UartFrame.h"
@@ -9,8 +10,41 @@
 
 #define UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN UINT8_MAX
 
+// Run UART protocol task only when RX data interrupt signals received data, instead of polling RX buffer in every scheduler round
+#define UART_PROTOCOL_RX_EVENT_ENABLE 1
+
+// Time the UART protocol task may spend on received frames in a single run, measured in TickHal_GetClockTick ticks (500 us at 72 MHz).
+// Frames left in the RX buffer are processed in the next scheduler round, 0 - single frame per task run
+#define UART_PROTOCOL_RX_BUDGET_CLOCK_TICKS 36000
+
+// Merge frames sent during the scheduler round into a single TX DMA transfer, started by UART protocol TX task
+#define UART_PROTOCOL_TX_COALESCING_ENABLE 1
+
+// Minimal time between the first pending frame and the TX DMA transfer start, 0 - transfer is started once per scheduler round
+#define UART_PROTOCOL_TX_COALESCING_WINDOW_US 0
+
+// Number of requests waiting for a response at the same time and the longest payload of a retried request
+#define UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS 8
+#define UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN 12
+
+// Measure clock ticks spent in UART command and mesh message handlers and the latency from the decoded frame to the handler call
+#define UART_PROTOCOL_HANDLER_PROFILING_ENABLE 0
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE && !UART_FRAME_READY_TICK_ENABLE
+#error "UART_PROTOCOL_HANDLER_PROFILING_ENABLE requires UART_FRAME_READY_TICK_ENABLE in UartFrame.h"
+#endif
+
+// Number of profiled commands and mesh opcodes, others are not profiled when all entries are taken
+#define UART_PROTOCOL_HANDLER_PROFILING_MAX_ENTRIES 16
+
+// Mesh opcode of handler statistics entry collected for UART command handlers
+#define UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE UINT32_MAX
+
 typedef void (*UartProtocolUartMessageHandler_T)(struct UartFrameRxTxFrame *p_frame);
 typedef void (*UartProtocolMeshMessageHandler_T)(struct UartProtocolFrameMeshMessageFrame *p_frame);
+typedef void (*UartProtocolTxSpaceCallback_T)(void);
+typedef void (*UartProtocolResponseCallback_T)(struct UartFrameRxTxFrame *p_frame);
+typedef void (*UartProtocolTimeoutCallback_T)(enum UartFrameCmd cmd, uint8_t instance_index);
 
 struct UartProtocolHandlerConfig
 {
@@ -26,6 +60,40 @@ struct UartProtocolHandlerConfig
     uint8_t instance_index;
 };
 
+struct UartProtocolTicksStats
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum; /**< Divided by cnt gives the mean */
+    uint32_t cnt;
+};
+
+/*
+ *  Handler profiling statistics of a single UART command or mesh opcode, measured in TickHal_GetClockTick ticks
+ */
+struct UartProtocolHandlerStats
+{
+    enum UartFrameCmd cmd;         /**< Received frame command, UART_FRAME_CMD_MESH_MESSAGE_REQUEST for mesh message handlers */
+    uint32_t          mesh_opcode; /**< Mesh opcode or UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE for UART command handlers */
+
+    struct UartProtocolTicksStats handler; /**< All handlers of the frame called one after another */
+    struct UartProtocolTicksStats latency; /**< From the decoded frame to the first handler call */
+};
+
+/*
+ *  Request tracked by UartProtocol_SendRequest, usually a constant defined by the module sending it
+ */
+struct UartProtocolRequestConfig
+{
+    UartProtocolResponseCallback_T p_response_callback; /**< Called with the matching response, optional */
+    UartProtocolTimeoutCallback_T  p_timeout_callback;  /**< Called when the response is not received after all retries, optional */
+
+    enum UartFrameCmd response_cmd;
+
+    uint16_t timeout_ms;  /**< Response timeout of the first attempt, doubled with every retry */
+    uint8_t  retries_cnt; /**< Number of times the request is sent again after the timeout */
+};
+
 void UartProtocol_Init(void);
 
 bool UartProtocol_IsInitialized(void);
@@ -34,8 +102,127 @@ void UartProtocol_RegisterMessageHandler(struct UartProtocolHandlerConfig *p_con
 
 void UartProtocol_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len);
 
+/*
+ *  Send frame with payload made of consecutive segments, e.g. header and data held by the caller.
+ *  Segments are written to the TX buffer without concatenating them first.
+ *
+ *  @param cmd              Frame command
+ *  @param p_segments       Payload segments
+ *  @param segments_cnt     Number of payload segments
+ */
+void UartProtocol_SendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt);
+
 void UartProtocol_SendFrame(struct UartFrameRxTxFrame *p_frame);
 
+/*
+ *  Send request and wait for its response in the background. Response is matched by the response command
+ *  and the instance index, if both the request and the response carry it. It is passed to the response
+ *  callback and to the message handlers registered for the response command as any other frame.
+ *  Sending the same request again (the same command, instance index and payload), while the previous one
+ *  is pending, restarts it. When UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS requests are pending, the oldest one
+ *  is dropped and its timeout callback is called after the new request is sent.
+ *
+ *  @param p_config         Request configuration, has to be valid until the request is completed
+ *  @param cmd              Request command
+ *  @param instance_index   Request instance index, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN if the request does not carry it
+ *  @param p_payload        Request payload, copied for retries
+ *  @param len              Payload length, up to UART_PROTOCOL_REQUEST_MAX_PAYLOAD_LEN if the request is retried
+ */
+void UartProtocol_SendRequest(const struct UartProtocolRequestConfig *p_config, enum UartFrameCmd cmd, uint8_t instance_index, uint8_t *p_payload, uint8_t len);
+
+/*
+ *  Check if response to the request has not been received yet
+ *
+ *  @param cmd              Request command
+ *  @param instance_index   Request instance index
+ *  @return                 True if request is pending
+ */
+bool UartProtocol_IsRequestPending(enum UartFrameCmd cmd, uint8_t instance_index);
+
+/*
+ *  Send frame if there is space in the TX buffer. When the frame is not sent, TX space callbacks
+ *  are called once the TX buffer is drained enough to send it.
+ *
+ *  @param cmd              Frame command
+ *  @param p_payload        Frame payload
+ *  @param len              Payload length
+ *  @return                 False if TX buffer is full and sending has to be deferred
+ */
+bool UartProtocol_TrySend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len);
+
+/*
+ *  Send frame with payload made of consecutive segments if there is space in the TX buffer,
+ *  see UartProtocol_TrySend
+ *
+ *  @param cmd              Frame command
+ *  @param p_segments       Payload segments
+ *  @param segments_cnt     Number of payload segments
+ *  @return                 False if TX buffer is full and sending has to be deferred, or if payload is too long
+ */
+bool UartProtocol_TrySendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt);
+
+/*
+ *  Check if frame can be sent without waiting for TX buffer space
+ *
+ *  @param cmd              Frame command
+ *  @param len              Payload length
+ *  @return                 True if the frame fits in the TX buffer
+ */
+bool UartProtocol_IsTxSpaceAvailable(enum UartFrameCmd cmd, uint8_t len);
+
+/*
+ *  Register callback called from UART protocol task when TX buffer space is available again
+ *  after UartProtocol_TrySend or UartProtocol_TrySendV has failed
+ *
+ *  @param p_callback       TX space callback
+ */
+void UartProtocol_RegisterTxSpaceCallback(UartProtocolTxSpaceCallback_T p_callback);
+
 void UartProtocol_Flush(void);
 
+/*
+ *  Change UART baud rate, it has to be agreed with the modem first
+ *
+ *  @param baudrate         New baud rate
+ */
+void UartProtocol_SetBaudrate(uint32_t baudrate);
+
+uint32_t UartProtocol_GetBaudrate(void);
+
+/*
+ *  Get RX statistics: received bytes and frames, decoding errors, RX buffer overruns and its high-water mark
+ *
+ *  @param p_stats          [out] RX statistics
+ */
+void UartProtocol_GetRxStats(struct UartFrameRxStats *p_stats);
+
+void UartProtocol_ClearRxStats(void);
+
+/*
+ *  Get TX statistics: number of sent frames and TX DMA transfers, which shows how many frames are merged by TX coalescing
+ *
+ *  @param p_stats          [out] TX statistics
+ */
+void UartProtocol_GetTxStats(struct UartFrameTxStats *p_stats);
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+/*
+ *  Get handler profiling statistics entry, entries are added when a handler of the command or the mesh opcode is called first time
+ *
+ *  @param entry_index      Statistics entry index
+ *  @param p_stats          [out] Handler statistics
+ *  @return                 False if there is no entry with the index
+ */
+bool UartProtocol_GetHandlerStats(uint8_t entry_index, struct UartProtocolHandlerStats *p_stats);
+
+uint8_t UartProtocol_GetHandlerStatsCnt(void);
+
+void UartProtocol_ClearHandlerStats(void);
+
+/*
+ *  Print handler profiling statistics with LOG_D
+ */
+void UartProtocol_LogHandlerStats(void);
+#endif
+
 #endif
@@ -11,6 +11,15 @@
 #define UART_PROTOCOL_ATTENTION_EVENT_OFF 0
 #define UART_PROTOCOL_ATTENTION_EVENT_ON 1
 
+#define UART_PROTOCOL_BAUDRATE_SET_STATUS_ACCEPTED 0x00
+#define UART_PROTOCOL_BAUDRATE_SET_STATUS_REJECTED 0x01
+
+#define UART_PROTOCOL_RX_STATS_KEEP 0x00
+#define UART_PROTOCOL_RX_STATS_CLEAR 0x01
+
+#define UART_PROTOCOL_HANDLER_STATS_KEEP 0x00
+#define UART_PROTOCOL_HANDLER_STATS_CLEAR 0x01
+
 #define UART_PROTOCOL_MESH_MESSAGE_OPCODE_LIGHT_L_GET 0x824B
 #define UART_PROTOCOL_MESH_MESSAGE_OPCODE_LIGHT_L_SET 0x824C
 #define UART_PROTOCOL_MESH_MESSAGE_OPCODE_LIGHT_L_SET_UNACKNOWLEDGED 0x824D
@@ -418,6 +427,76 @@ struct PACKED UartProtocolFrameTimeGetResponse
     uint8_t  time_zone_offset;
 };
 
+struct PACKED UartProtocolFrameBaudrateSetRequest
+{
+    uint8_t  len;
+    uint8_t  cmd;
+    uint32_t baudrate;
+};
+
+struct PACKED UartProtocolFrameBaudrateSetResponse
+{
+    uint8_t  len;
+    uint8_t  cmd;
+    uint8_t  status;
+    uint32_t baudrate;
+};
+
+struct PACKED UartProtocolFrameRxStatsRequest
+{
+    uint8_t len;
+    uint8_t cmd;
+    uint8_t clear;
+};
+
+struct PACKED UartProtocolFrameRxStatsResponse
+{
+    uint8_t  len;
+    uint8_t  cmd;
+    uint32_t bytes_cnt;
+    uint32_t frames_cnt;
+    uint32_t crc_errors_cnt;
+    uint32_t preamble_errors_cnt;
+    uint32_t length_errors_cnt;
+    uint32_t command_errors_cnt;
+    uint32_t overruns_cnt;
+    uint16_t buffer_high_water_mark;
+    uint16_t buffer_len;
+};
+
+struct PACKED UartProtocolFrameTxStatsResponse
+{
+    uint8_t  len;
+    uint8_t  cmd;
+    uint32_t frames_cnt;
+    uint32_t dma_transfers_cnt;
+};
+
+struct PACKED UartProtocolFrameHandlerStatsRequest
+{
+    uint8_t len;
+    uint8_t cmd;
+    uint8_t entry_index;
+    uint8_t clear;
+};
+
+struct PACKED UartProtocolFrameHandlerStatsResponse
+{
+    uint8_t  len;
+    uint8_t  cmd;
+    uint8_t  entry_index;
+    uint8_t  entries_cnt;
+    uint8_t  handler_cmd;
+    uint32_t mesh_opcode;
+    uint32_t calls_cnt;
+    uint32_t handler_min_ticks;
+    uint32_t handler_max_ticks;
+    uint32_t handler_mean_ticks;
+    uint32_t latency_min_ticks;
+    uint32_t latency_max_ticks;
+    uint32_t latency_mean_ticks;
+};
+
 struct PACKED UartProtocolFrameDfuInitRequest
 {
     uint8_t  len;
@@ -568,6 +647,13 @@ STATIC_ASSERT(sizeof(struct UartProtocolFrameTimeSourceGetRequest) == 3, Wrong_s
 STATIC_ASSERT(sizeof(struct UartProtocolFrameTimeSourceGetResponse) == 12, Wrong_size_of_the_struct_UartProtocolFrameTimeSourceGetResponse);
 STATIC_ASSERT(sizeof(struct UartProtocolFrameTimeGetRequest) == 3, Wrong_size_of_the_struct_UartProtocolFrameTimeGetRequest);
 STATIC_ASSERT(sizeof(struct UartProtocolFrameTimeGetResponse) == 12, Wrong_size_of_the_struct_UartProtocolFrameTimeGetResponse);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameBaudrateSetRequest) == 6, Wrong_size_of_the_struct_UartProtocolFrameBaudrateSetRequest);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameBaudrateSetResponse) == 7, Wrong_size_of_the_struct_UartProtocolFrameBaudrateSetResponse);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameRxStatsRequest) == 3, Wrong_size_of_the_struct_UartProtocolFrameRxStatsRequest);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameRxStatsResponse) == 34, Wrong_size_of_the_struct_UartProtocolFrameRxStatsResponse);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameTxStatsResponse) == 10, Wrong_size_of_the_struct_UartProtocolFrameTxStatsResponse);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameHandlerStatsRequest) == 4, Wrong_size_of_the_struct_UartProtocolFrameHandlerStatsRequest);
+STATIC_ASSERT(sizeof(struct UartProtocolFrameHandlerStatsResponse) == 37, Wrong_size_of_the_struct_UartProtocolFrameHandlerStatsResponse);
 STATIC_ASSERT(sizeof(struct UartProtocolFrameDfuInitRequest) == 39, Wrong_size_of_the_struct_UartProtocolFrameDfuInitRequest);
 STATIC_ASSERT(sizeof(struct UartProtocolFrameDfuInitResponse) == 3, Wrong_size_of_the_struct_UartProtocolFrameDfuInitResponse);
 STATIC_ASSERT(sizeof(struct UartProtocolFrameDfuStatusRequest) == 2, Wrong_size_of_the_struct_UartProtocolFrameDfuStatusRequest);
@@ -20,6 +20,7 @@
 #define ENABLE_PIRALS 1     /**< Enable PIR and ALS support */
 #define ENABLE_ENERGY 1     /**< Enable energy monitoring support */
 #define ENABLE_EMG_L_TEST 1 /**< Enable Emergency Lighting Testing support */
+#define ENABLE_UART_BAUDRATE 0 /**< Enable UART baud rate negotiation with the modem */
 
 #define DFU_VALIDATION_STRING "MCU_Srv" /**< Defines string to be expected in app data */
 #endif
@@ -31,6 +32,7 @@
 #define ENABLE_PIRALS 0     /**< Enable PIR and ALS support */
 #define ENABLE_ENERGY 0     /**< Enable energy monitoring support */
 #define ENABLE_EMG_L_TEST 0 /**< Enable Emergency Lighting Testing support */
+#define ENABLE_UART_BAUDRATE 0 /**< Enable UART baud rate negotiation with the modem */
 
 #define DFU_VALIDATION_STRING "MCU_Cli" /**< Defines string to be expected in app data */
 #endif
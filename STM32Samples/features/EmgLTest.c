@@ -63,6 +63,7 @@ static void MeshMessageRequest1Send(struct UartProtocolFrameMeshMessageFrame *p_
 
 static enum EmgLTest_ElState GetElState(void);
 static void                  UpdateBatteryStatus(void);
+static void                  UartTxSpaceCallback(void);
 static void                  StopTestIfPending(void);
 static void                  DisableAutoTest(void);
 static uint8_t               FitEmergencyLevelToMinMax(uint8_t emergency_level);
@@ -149,6 +150,7 @@ struct PACKED EmergencyMode
 static bool    IsInitialized                     = false;
 static uint8_t InhibitRefreshCounterSeconds      = INHIBIT_TIMER_REFRESH_TIME_S;
 static uint8_t BatteryStatusUpdateCounterSeconds = BATTERY_STATUS_UPDATE_TIME_S;
+static bool    IsBatteryStatusPending            = false;
 
 
 static void LoopEmgLTest(void)
@@ -193,6 +195,7 @@ void EmgLTest_Init(void)
 
     ModelManager_RegisterModel(&ModelConfigLightEltServer);
     UartProtocol_RegisterMessageHandler(&MessageHandlerConfig);
+    UartProtocol_RegisterTxSpaceCallback(UartTxSpaceCallback);
 
     InhibitRefreshCounterSeconds = 0;
 
@@ -477,7 +480,7 @@ static void ElOperationTimeGet(struct UartProtocolFrameMeshMessageFrame *p_frame
     }
 
     MeshMessageRequest1Send(p_frame, EMG_L_TEST_EL_SUBOPCODE_OPERATION_TIME_STATUS, (uint8_t *)&resp, sizeof(resp));
-    LOG_D("EL Operation Time Status, Emergency Time: %ld, Total Operation Time: %ld", resp.emergency_time, resp.total_operation_time);
+    LOG_D("EL Operation Time Status, Emergency Time: %u, Total Operation Time: %u", (unsigned int)resp.emergency_time, (unsigned int)resp.total_operation_time);
 }
 
 static void ElOperationTimeClear(struct UartProtocolFrameMeshMessageFrame *p_frame)
@@ -514,7 +517,7 @@ static void ElOperationTimeClear(struct UartProtocolFrameMeshMessageFrame *p_fra
     }
 
     MeshMessageRequest1Send(p_frame, EMG_L_TEST_EL_SUBOPCODE_OPERATION_TIME_STATUS, (uint8_t *)&resp, sizeof(resp));
-    LOG_D("EL Operation Time Status, Emergency Time: %ld, Total Operation Time: %ld", resp.emergency_time, resp.total_operation_time);
+    LOG_D("EL Operation Time Status, Emergency Time: %u, Total Operation Time: %u", (unsigned int)resp.emergency_time, (unsigned int)resp.total_operation_time);
 }
 
 static void EltFunctionalTestStart(struct UartProtocolFrameMeshMessageFrame *p_frame)
@@ -686,19 +689,23 @@ static void MeshMessageRequest1Send(struct UartProtocolFrameMeshMessageFrame *p_
 {
     ASSERT((p_frame->mesh_opcode & (MESH_OPCODE_SIZE_3_OCTET_MASK << 16)) == (MESH_OPCODE_SIZE_3_OCTET_MASK << 16));
 
-    size_t size = sizeof(struct UartProtocolFrameMeshMessageRequest1Opcode3B) + sizeof(subopcode) + len;
+    struct UartProtocolFrameMeshMessageRequest1Opcode3B header;
+    header.instance_index = p_frame->instance_index;
+    header.sub_index      = p_frame->sub_index;
+    header.mesh_opcode_be = SWAP_3_BYTES(p_frame->mesh_opcode);
 
-    uint8_t                                              buff[size];
-    struct UartProtocolFrameMeshMessageRequest1Opcode3B *p_tx_frame = (struct UartProtocolFrameMeshMessageRequest1Opcode3B *)buff;
-    p_tx_frame->cmd                                                 = UART_FRAME_CMD_MESH_MESSAGE_REQUEST1;
-    p_tx_frame->len                                                 = size - UART_PROTOCOL_FRAME_HEADER_LEN;
-    p_tx_frame->instance_index                                      = p_frame->instance_index;
-    p_tx_frame->mesh_opcode_be                                      = SWAP_3_BYTES(p_frame->mesh_opcode);
-    p_tx_frame->sub_index                                           = p_frame->sub_index;
-    p_tx_frame->p_data[0]                                           = subopcode;
-    memcpy(p_tx_frame->p_data + 1, p_payload, len);
+    // Frame length and command are added by UART frame layer
+    struct UartFrameSegment segments[] = {
+        {(uint8_t *)&header + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(header) - UART_PROTOCOL_FRAME_HEADER_LEN},
+        {&subopcode, sizeof(subopcode)},
+        {p_payload, len},
+    };
 
-    UartProtocol_SendFrame((struct UartFrameRxTxFrame *)p_tx_frame);
+    if (!UartProtocol_TrySendV(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, segments, ARRAY_SIZE(segments)))
+    {
+        // Response is not stored, the client retransmits the request
+        LOG_W("ELT response dropped, UART TX buffer is full");
+    }
 }
 
 static enum EmgLTest_ElState GetElState(void)
@@ -789,7 +796,14 @@ static void UpdateBatteryStatus(void)
     p_payload->time_to_discharge = BATTERY_TIME_TO_DISCHARGE_UNKNOWN;
     p_payload->time_to_charge    = BATTERY_TIME_TO_CHARGE_UNKNOWN;
 
-    UartProtocol_Send(UART_FRAME_CMD_BATTERY_STATUS_SET_REQ, payload + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(payload) - UART_PROTOCOL_FRAME_HEADER_LEN);
+    // Battery status is sent again from the TX space callback
+    IsBatteryStatusPending = !UartProtocol_TrySend(UART_FRAME_CMD_BATTERY_STATUS_SET_REQ,
+                                                   payload + UART_PROTOCOL_FRAME_HEADER_LEN,
+                                                   sizeof(payload) - UART_PROTOCOL_FRAME_HEADER_LEN);
+    if (IsBatteryStatusPending)
+    {
+        return;
+    }
 
     if (p_payload->battery_level != BATTERY_LEVEL_UNKNOWN)
     {
@@ -801,6 +815,14 @@ static void UpdateBatteryStatus(void)
     }
 }
 
+static void UartTxSpaceCallback(void)
+{
+    if (IsBatteryStatusPending)
+    {
+        UpdateBatteryStatus();
+    }
+}
+
 static void StopTestIfPending(void)
 {
     uint8_t                 emergency_status   = EmergencyDriverSimulator_QueryEmergencyStatus();
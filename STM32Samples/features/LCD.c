@@ -161,7 +161,8 @@ void LCD_Setup(void)
         LcdDrv_Init();
     }
 
-    DisplayScreen(LCD_CurrentScreen);
+    // Screen is displayed when the display startup is done
+    LCD_NeedsUpdate = true;
 
     SimpleScheduler_TaskAdd(LCD_TASK_PERIOD_MS, LCD_Loop, SIMPLE_SCHEDULER_TASK_ID_LCD, true);
 }
@@ -286,6 +287,11 @@ void LCD_EraseSensorsValues(void)
 
 static void LCD_Loop(void)
 {
+    if (!LcdDrv_IsInitialized())
+    {
+        return;
+    }
+
     bool switchScreen = (Timestamp_GetTimeElapsed(LCD_CurrentScreenTimestamp, Timestamp_GetCurrent()) >= LCD_SCREEN_SWITCH_INTV_MS);
     CheckSensorValuesExpiration();
     CheckTimeDisplayNeedUpdate();
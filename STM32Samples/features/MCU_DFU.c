@@ -38,11 +38,6 @@
 
 #define DFU_CRC32_INIT_VAL 0xFFFFFFFFu
 
-
-/**< CRC configuration */
-#define CRC_POLYNOMIAL 0x8005u
-#define CRC_INIT_VAL 0xFFFFu
-
 /**< Defines string that forces update */
 #define DFU_VALIDATION_IGNORE_STRING "ignore"
 
@@ -88,6 +83,10 @@ static uint8_t PageBuffer[MAX_PAGE_SIZE] = {0};
 static size_t  PageOffset                = 0;
 static size_t  PageSize                  = 0;
 
+// CRC32 and SHA256 of the firmware stored in the Flash memory, updated when a page is stored
+static uint32_t                     FirmwareCrc = ~DFU_CRC32_INIT_VAL;
+static struct ChecksumSHA256Context FirmwareSha256Ctx;
+
 void MCU_DFU_Setup(void)
 {
     if (!GpioHal_IsInitialized())
@@ -103,7 +102,7 @@ void MCU_DFU_Setup(void)
     ClearStates();
 
     LOG_D("DFU space start addr: 0x%08X", (unsigned int)FlashHal_GetSpaceAddress());
-    LOG_D("DFU available bytes:  %d", FlashHal_GetSpaceSize());
+    LOG_D("DFU available bytes:  %u", (unsigned int)FlashHal_GetSpaceSize());
 
     UartProtocol_RegisterMessageHandler(&MessageHandlerConfig);
 }
@@ -165,8 +164,8 @@ static void ProcessDfuInitRequest(uint8_t *p_payload, uint8_t len)
     }
 
     LOG_D("DFU Init:");
-    LOG_D("Size: %d", FirmwareSize);
-    LOG_D("Available:%d", available);
+    LOG_D("Size: %u", (unsigned int)FirmwareSize);
+    LOG_D("Available:%u", (unsigned int)available);
     LOG_HEX_D("SHA256:", Sha256, SHA256_SIZE);
 
     UNUSED(len);
@@ -324,6 +323,10 @@ static void ProcessDfuPageStoreRequest(uint8_t *p_payload, uint8_t len)
         return;
     }
 
+    // CRC and SHA256 are calculated from the Flash memory, so pages that were not stored correctly are detected
+    FirmwareCrc = Checksum_CalcCRC32((uint8_t *)((uintptr_t)page_store_address), PageOffset, ~FirmwareCrc);
+    Checksum_UpdateSHA256(&FirmwareSha256Ctx, (uint8_t *)((uintptr_t)page_store_address), PageOffset);
+
     FirmwareOffset += PageOffset;
     PageOffset = 0;
     PageSize   = 0;
@@ -333,13 +336,12 @@ static void ProcessDfuPageStoreRequest(uint8_t *p_payload, uint8_t len)
         uint8_t response[] = {DFU_SUCCESS};
         UartProtocol_Send(UART_FRAME_CMD_DFU_PAGE_STORE_RESP, response, sizeof(response));
 
-        uint32_t crc = Checksum_CalcCRC32((uint8_t *)((uintptr_t)FlashHal_GetSpaceAddress()), FirmwareOffset, CRC_INIT_VAL);
-        LOG_D("DFU Page store success, CRC %08X", (unsigned int)crc);
+        LOG_D("DFU Page store success, CRC %08X", (unsigned int)FirmwareCrc);
         return;
     }
 
     uint8_t calculated_sha256[SHA256_SIZE];
-    Checksum_CalcSHA256((uint8_t *)((uintptr_t)FlashHal_GetSpaceAddress()), FirmwareOffset, calculated_sha256);
+    Checksum_FinalSHA256(&FirmwareSha256Ctx, calculated_sha256);
     bool is_object_valid = (0 == memcmp(calculated_sha256, Sha256, SHA256_SIZE));
 
     if (!is_object_valid)
@@ -450,22 +452,21 @@ static void ClearStates(void)
     DfuInProgress  = 0;
     FirmwareSize   = 0;
     FirmwareOffset = 0;
+    FirmwareCrc    = ~DFU_CRC32_INIT_VAL;
     PageOffset     = 0;
     PageSize       = 0;
 
     memset(Sha256, 0, SHA256_SIZE);
     memset(PageBuffer, 0, MAX_PAGE_SIZE);
 
+    Checksum_InitSHA256(&FirmwareSha256Ctx);
+
     LCD_UpdateDfuState(DfuInProgress);
 }
 
 static uint32_t CalcCRC(void)
 {
-    uint32_t crc = ~DFU_CRC32_INIT_VAL;
-    if (FirmwareOffset != 0)
-    {
-        crc = Checksum_CalcCRC32((uint8_t *)((uintptr_t)FlashHal_GetSpaceAddress()), FirmwareOffset, ~crc);
-    }
+    uint32_t crc = FirmwareCrc;
     if (PageOffset != 0)
     {
         crc = Checksum_CalcCRC32(PageBuffer, PageOffset, ~crc);
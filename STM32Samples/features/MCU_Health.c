@@ -20,18 +20,22 @@
 #define PB_FAULT GPIO_HAL_PIN_SW1      /**< Defines Fault (used to Set and Clear faults) button location. */
 #define PB_CONNECTION GPIO_HAL_PIN_SW2 /**< Defines Connection (used to disconnect and connect UART) button location. */
 
-#define HEALTH_MESSAGE_SET_FAULT_LEN 4
-#define HEALTH_MESSAGE_CLEAR_FAULT_LEN 4
 #define TEST_MSG_LEN 4
+#define TEST_MSG_INSTANCE_INDEX_OFFSET 3
 
 #define EXAMPLE_FAULT_ID 0x01u
 
 #define BUTTON_DEBOUNCE_TIME_MS 20 /**< Defines buttons debounce time in milliseconds. */
 #define TEST_TIME_MS 1500          /**< Defines fake test duration in milliseconds. */
 
+#define HEALTH_REQUEST_TIMEOUT_MS 500 /**< Defines time for the modem to respond to the health requests in milliseconds. */
+#define HEALTH_REQUEST_RETRIES_CNT 2  /**< Defines number of health request retries. */
+
 static void LoopHealth(void);
 static void ProcessStartTest(uint8_t *p_payload, uint8_t len);
 static void UartMessageHandler(struct UartFrameRxTxFrame *p_frame);
+static void SendFaultRequest(const struct UartProtocolRequestConfig *p_config, enum UartFrameCmd cmd, uint16_t company_id, uint8_t fault_id, uint8_t instance_idx);
+static void ProcessRequestTimeout(enum UartFrameCmd cmd, uint8_t instance_index);
 
 static const enum UartFrameCmd UartFrameCommandList[] = {UART_FRAME_CMD_START_TEST_REQ};
 
@@ -45,6 +49,30 @@ static struct UartProtocolHandlerConfig MessageHandlerConfig = {
     .instance_index               = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
 };
 
+static const struct UartProtocolRequestConfig SetFaultRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_SET_FAULT_RESPONSE,
+    .timeout_ms          = HEALTH_REQUEST_TIMEOUT_MS,
+    .retries_cnt         = HEALTH_REQUEST_RETRIES_CNT,
+};
+
+static const struct UartProtocolRequestConfig ClearFaultRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_CLEAR_FAULT_RESPONSE,
+    .timeout_ms          = HEALTH_REQUEST_TIMEOUT_MS,
+    .retries_cnt         = HEALTH_REQUEST_RETRIES_CNT,
+};
+
+static const struct UartProtocolRequestConfig TestFinishedRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessRequestTimeout,
+    .response_cmd        = UART_FRAME_CMD_TEST_FINISHED_RESP,
+    .timeout_ms          = HEALTH_REQUEST_TIMEOUT_MS,
+    .retries_cnt         = HEALTH_REQUEST_RETRIES_CNT,
+};
+
 static const struct ModelParametersHealthServer1Id health_registration_parameters = {
     .number_of_company_ids = 0x01,    //Number of company IDs
     .company_id_list       = {SILVAIR_ID},
@@ -83,28 +111,12 @@ void MCU_Health_Setup(void)
 
 void MCU_Health_SendSetFaultRequest(uint16_t company_id, uint8_t fault_id, uint8_t instance_idx)
 {
-    uint8_t buf[HEALTH_MESSAGE_SET_FAULT_LEN];
-    size_t  index = 0;
-
-    buf[index++] = LOW_BYTE(company_id);
-    buf[index++] = HIGH_BYTE(company_id);
-    buf[index++] = fault_id;
-    buf[index++] = instance_idx;
-
-    UartProtocol_Send(UART_FRAME_CMD_SET_FAULT_REQUEST, buf, sizeof(buf));
+    SendFaultRequest(&SetFaultRequestConfig, UART_FRAME_CMD_SET_FAULT_REQUEST, company_id, fault_id, instance_idx);
 }
 
 void MCU_Health_SendClearFaultRequest(uint16_t company_id, uint8_t fault_id, uint8_t instance_idx)
 {
-    uint8_t buf[HEALTH_MESSAGE_CLEAR_FAULT_LEN];
-    size_t  index = 0;
-
-    buf[index++] = LOW_BYTE(company_id);
-    buf[index++] = HIGH_BYTE(company_id);
-    buf[index++] = fault_id;
-    buf[index++] = instance_idx;
-
-    UartProtocol_Send(UART_FRAME_CMD_CLEAR_FAULT_REQUEST, buf, sizeof(buf));
+    SendFaultRequest(&ClearFaultRequestConfig, UART_FRAME_CMD_CLEAR_FAULT_REQUEST, company_id, fault_id, instance_idx);
 }
 
 bool MCU_Health_IsTestInProgress(void)
@@ -120,11 +132,26 @@ static void LoopHealth(void)
         {
             TestStarted = false;
             GpioHal_PinSet(GPIO_HAL_PIN_LED_STATUS, false);
-            UartProtocol_Send(UART_FRAME_CMD_TEST_FINISHED_REQ, TestStartPayload, TEST_MSG_LEN);
+
+            uint8_t instance_index = TestStartPayload[TEST_MSG_INSTANCE_INDEX_OFFSET];
+            UartProtocol_SendRequest(&TestFinishedRequestConfig, UART_FRAME_CMD_TEST_FINISHED_REQ, instance_index, TestStartPayload, TEST_MSG_LEN);
         }
     }
 }
 
+static void SendFaultRequest(const struct UartProtocolRequestConfig *p_config, enum UartFrameCmd cmd, uint16_t company_id, uint8_t fault_id, uint8_t instance_idx)
+{
+    // Payload is copied by UART protocol for retries, so it is not split into segments
+    uint8_t payload[] = {LOW_BYTE(company_id), HIGH_BYTE(company_id), fault_id, instance_idx};
+
+    UartProtocol_SendRequest(p_config, cmd, instance_idx, payload, sizeof(payload));
+}
+
+static void ProcessRequestTimeout(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    LOG_W("Health request 0x%02X not acknowledged, instance index %d", cmd, instance_index);
+}
+
 static void ProcessStartTest(uint8_t *p_payload, uint8_t len)
 {
     UartProtocol_Send(UART_FRAME_CMD_START_TEST_RESP, NULL, 0);
@@ -163,10 +163,10 @@ struct ModelManagerRegistrationRow ModelConfigSensorServerVoltagePower = {
     .p_instance_index    = &SensorInputVoltPowIdx,
 };
 
-static void ProcessPIR(void);
-static void ProcessALS(void);
-static void ProcessCurrentEnergy(void);
-static void ProcessVoltagePower(void);
+static bool ProcessPIR(void);
+static bool ProcessALS(void);
+static bool ProcessCurrentEnergy(void);
+static bool ProcessVoltagePower(void);
 
 static void Sensor_Loop(void);
 
@@ -217,29 +217,26 @@ static void Sensor_Loop(void)
     static unsigned long timestamp_curr_energy = 0;
     static unsigned long timestamp_volt_power  = 0;
 
-    if (Timestamp_GetTimeElapsed(timestamp_pir, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_PIR_MS)
+    // Timestamp is not updated when TX buffer is full, so the update is sent in the next round
+    if ((Timestamp_GetTimeElapsed(timestamp_pir, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_PIR_MS) && ProcessPIR())
     {
         timestamp_pir = Timestamp_GetCurrent();
-        ProcessPIR();
     }
-    if (Timestamp_GetTimeElapsed(timestamp_als, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_ALS_MS)
+    if ((Timestamp_GetTimeElapsed(timestamp_als, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_ALS_MS) && ProcessALS())
     {
         timestamp_als = Timestamp_GetCurrent();
-        ProcessALS();
     }
-    if (Timestamp_GetTimeElapsed(timestamp_curr_energy, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_CURR_ENERGY_MS)
+    if ((Timestamp_GetTimeElapsed(timestamp_curr_energy, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_CURR_ENERGY_MS) && ProcessCurrentEnergy())
     {
         timestamp_curr_energy = Timestamp_GetCurrent();
-        ProcessCurrentEnergy();
     }
-    if (Timestamp_GetTimeElapsed(timestamp_volt_power, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_VOLT_POWER_MS)
+    if ((Timestamp_GetTimeElapsed(timestamp_volt_power, Timestamp_GetCurrent()) >= SENSOR_UPDATE_INTV_VOLT_POWER_MS) && ProcessVoltagePower())
     {
         timestamp_volt_power = Timestamp_GetCurrent();
-        ProcessVoltagePower();
     }
 }
 
-static void ProcessPIR(void)
+static bool ProcessPIR(void)
 {
     if (SensorInputPirIdx != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN || Luminaire_IsStartupBehaviorInProgress())
     {
@@ -251,11 +248,13 @@ static void ProcessPIR(void)
             HIGH_BYTE(MODEL_MANAGER_SENSOR_SERVER_PROP_ID_PRESENCE_DETECTED),
             pir,
         };
-        UartProtocol_Send(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, pir_buf, sizeof(pir_buf));
+        return UartProtocol_TrySend(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, pir_buf, sizeof(pir_buf));
     }
+
+    return true;
 }
 
-static void ProcessALS(void)
+static bool ProcessALS(void)
 {
     if (SensorInputAlsIdx != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN || Luminaire_IsStartupBehaviorInProgress())
     {
@@ -284,11 +283,13 @@ static void ProcessALS(void)
             (uint8_t)(als_centilux >> 16),
         };
 
-        UartProtocol_Send(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, als_buf, sizeof(als_buf));
+        return UartProtocol_TrySend(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, als_buf, sizeof(als_buf));
     }
+
+    return true;
 }
 
-static void ProcessCurrentEnergy(void)
+static bool ProcessCurrentEnergy(void)
 {
     uint16_t current = EnergySensorSimulator_GetCurrent_mA() / 10;
     uint32_t energy  = EnergySensorSimulator_GetEnergy_Wh() / 1000;
@@ -307,11 +308,13 @@ static void ProcessCurrentEnergy(void)
             (uint8_t)(energy >> 8),
             (uint8_t)(energy >> 16),
         };
-        UartProtocol_Send(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, currenergy_buf, sizeof(currenergy_buf));
+        return UartProtocol_TrySend(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, currenergy_buf, sizeof(currenergy_buf));
     }
+
+    return true;
 }
 
-static void ProcessVoltagePower(void)
+static bool ProcessVoltagePower(void)
 {
     uint16_t voltage = (uint16_t)((float)EnergySensorSimulator_GetVoltage_mV() * 64 / 1000);
     uint32_t power   = EnergySensorSimulator_GetPower_mW() / 100;
@@ -330,6 +333,8 @@ static void ProcessVoltagePower(void)
             (uint8_t)(power >> 8),
             (uint8_t)(power >> 16),
         };
-        UartProtocol_Send(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, voltpow_buf, sizeof(voltpow_buf));
+        return UartProtocol_TrySend(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, voltpow_buf, sizeof(voltpow_buf));
     }
+
+    return true;
 }
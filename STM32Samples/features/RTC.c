@@ -29,6 +29,8 @@
 #define BATTERY_LEVEL_LOW_PERCENT 30
 #define BATTERY_LEVEL_CRITICAL_LOW_PERCENT 10
 #define BATTERY_NOT_DETECTED_THRESHOLD_PERCENT 0
+#define BATTERY_STATUS_SET_TIMEOUT_MS 500
+#define BATTERY_STATUS_SET_RETRIES_CNT 2
 
 #define HEALTH_FAULT_ID_BATTERY_LOW_WARNING 0x01
 #define HEALTH_FAULT_ID_BATTERY_LOW_ERROR 0x02
@@ -61,6 +63,16 @@ static void MeasureBatteryLevel(void);
 static void PeriodicBatteryMeasurement(void);
 static void UpdateBatteryStatus(void);
 static void UpdateHealthFaultStatus(void);
+static void ProcessBatteryStatusSetTimeout(enum UartFrameCmd cmd, uint8_t instance_index);
+
+// Battery Status Set Response carries no data, only the request delivery is tracked
+static const struct UartProtocolRequestConfig BatteryStatusSetRequestConfig = {
+    .p_response_callback = NULL,
+    .p_timeout_callback  = ProcessBatteryStatusSetTimeout,
+    .response_cmd        = UART_FRAME_CMD_BATTERY_STATUS_SET_RESP,
+    .timeout_ms          = BATTERY_STATUS_SET_TIMEOUT_MS,
+    .retries_cnt         = BATTERY_STATUS_SET_RETRIES_CNT,
+};
 
 static bool                          IsInitialized              = false;
 static bool                          IsAvailable                = false;
@@ -345,7 +357,15 @@ static void UpdateBatteryStatus(void)
         battery_flags,
     };
 
-    UartProtocol_Send(UART_FRAME_CMD_BATTERY_STATUS_SET_REQ, payload, sizeof(payload));
+    UartProtocol_SendRequest(&BatteryStatusSetRequestConfig, UART_FRAME_CMD_BATTERY_STATUS_SET_REQ, *pInstanceIndex, payload, sizeof(payload));
+}
+
+static void ProcessBatteryStatusSetTimeout(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    LOG_W("Battery Status Set Response not received");
+
+    UNUSED(cmd);
+    UNUSED(instance_index);
 }
 
 static void UpdateHealthFaultStatus(void)
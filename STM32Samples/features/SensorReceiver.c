@@ -87,7 +87,7 @@ static void ProcessSensorStatus(uint8_t *p_payload, size_t len)
     size_t index = 0;
     while (index < len)
     {
-        LOG_D("ProcessSensorStatus index: %d", index);
+        LOG_D("ProcessSensorStatus index: %u", (unsigned int)index);
         if (p_payload[index] & SS_FORMAT_MASK)
         {
             /* Length field in Sensor Status message is 0-based */
@@ -8,27 +8,22 @@
 
 #define MESH_TIME_TASK_PERIOD_MS 1
 #define SYNC_TIME_PERIOD_MS (1000 * 60)
+#define TIME_GET_TIMEOUT_MS 500
+#define TIME_GET_RETRIES_CNT 3
 
 static void SendTimeGetReq(void);
-static void ProcessTimeGetResponse(uint8_t *p_payload, uint8_t len);
+static void ProcessTimeGetResponse(struct UartFrameRxTxFrame *p_frame);
+static void ProcessTimeGetTimeout(enum UartFrameCmd cmd, uint8_t instance_index);
 static void LoopTimeReceiver(void);
-static void UartMessageHandler(struct UartFrameRxTxFrame *p_frame);
 
-static const enum UartFrameCmd UartFrameCommandList[] = {
-    UART_FRAME_CMD_TIME_GET_RESP,
+static const struct UartProtocolRequestConfig TimeGetRequestConfig = {
+    .p_response_callback = ProcessTimeGetResponse,
+    .p_timeout_callback  = ProcessTimeGetTimeout,
+    .response_cmd        = UART_FRAME_CMD_TIME_GET_RESP,
+    .timeout_ms          = TIME_GET_TIMEOUT_MS,
+    .retries_cnt         = TIME_GET_RETRIES_CNT,
 };
 
-static struct UartProtocolHandlerConfig MessageHandlerConfig = {
-    .p_uart_message_handler       = UartMessageHandler,
-    .p_mesh_message_handler       = NULL,
-    .p_uart_frame_command_list    = UartFrameCommandList,
-    .p_mesh_message_opcode_list   = NULL,
-    .uart_frame_command_list_len  = ARRAY_SIZE(UartFrameCommandList),
-    .mesh_message_opcode_list_len = 0,
-    .instance_index               = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
-};
-
-
 static struct TimeReceiver_MeshTimeLastSync LastSyncTime   = {0};
 static bool                                 IsInitialized  = false;
 static uint8_t                             *pInstanceIndex = NULL;
@@ -39,8 +34,6 @@ void TimeReceiver_Init(uint8_t *p_instance_index)
 
     pInstanceIndex = p_instance_index;
 
-    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig);
-
     IsInitialized = true;
 }
 
@@ -59,17 +52,19 @@ static void SendTimeGetReq(void)
     struct TimeGetReq msg = {0};
     msg.instance_index    = *pInstanceIndex;
 
-    UartProtocol_Send(UART_FRAME_CMD_TIME_GET_REQ, (uint8_t *)&msg, sizeof(msg));
+    UartProtocol_SendRequest(&TimeGetRequestConfig, UART_FRAME_CMD_TIME_GET_REQ, msg.instance_index, (uint8_t *)&msg, sizeof(msg));
 }
 
-static void ProcessTimeGetResponse(uint8_t *p_payload, uint8_t len)
+static void ProcessTimeGetResponse(struct UartFrameRxTxFrame *p_frame)
 {
-    if ((p_payload == NULL) || (len != sizeof(struct TimeGetResp)))
+    ASSERT(p_frame != NULL);
+
+    if (p_frame->len != sizeof(struct TimeGetResp))
     {
         return;
     }
 
-    struct TimeGetResp *msg = (struct TimeGetResp *)p_payload;
+    struct TimeGetResp *msg = (struct TimeGetResp *)p_frame->p_payload;
 
     LastSyncTime.local_sync_timestamp_ms = Timestamp_GetCurrent();
     LastSyncTime.tai_seconds             = msg->tai_seconds;
@@ -78,6 +73,15 @@ static void ProcessTimeGetResponse(uint8_t *p_payload, uint8_t len)
     LastSyncTime.time_zone_offset        = msg->time_zone_offset;
 }
 
+static void ProcessTimeGetTimeout(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    // Last sync time is kept, the next request is sent after the sync period
+    LOG_W("Time Get Response not received");
+
+    UNUSED(cmd);
+    UNUSED(instance_index);
+}
+
 static void LoopTimeReceiver(void)
 {
     static uint32_t last_sync_time_ms = 0;
@@ -89,18 +93,3 @@ static void LoopTimeReceiver(void)
         SendTimeGetReq();
     }
 }
-
-static void UartMessageHandler(struct UartFrameRxTxFrame *p_frame)
-{
-    ASSERT(p_frame != NULL);
-
-    switch (p_frame->cmd)
-    {
-        case UART_FRAME_CMD_TIME_GET_RESP:
-            ProcessTimeGetResponse(p_frame->p_payload, p_frame->len);
-            break;
-
-        default:
-            break;
-    }
-}
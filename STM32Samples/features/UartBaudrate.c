@@ -0,0 +1,295 @@
+#include "UartBaudrate.h"
+
+#include <stddef.h>
+
+#include "Assert.h"
+#include "Log.h"
+#include "SimpleScheduler.h"
+#include "Timestamp.h"
+#include "UartProtocol.h"
+#include "Utils.h"
+
+#define UART_BAUDRATE_TASK_PERIOD_MS 10
+
+#define UART_BAUDRATE_START_DELAY_MS 1000          /**< Delay after modem start, lets the initial frames exchange finish */
+#define UART_BAUDRATE_RESPONSE_TIMEOUT_MS 500      /**< Time for the modem to respond to the baud rate set request */
+#define UART_BAUDRATE_VERIFY_TIMEOUT_MS 500        /**< Time for the link verification after baud rate change */
+#define UART_BAUDRATE_VERIFY_PING_INTERVAL_MS 100  /**< Ping interval during the link verification */
+#define UART_BAUDRATE_KEEPALIVE_INTERVAL_MS 1000   /**< Ping interval while the negotiated baud rate is used */
+#define UART_BAUDRATE_KEEPALIVE_TIMEOUT_MS 3500    /**< Time without pong after which default baud rate is restored and the modem is restarted */
+
+static void UartBaudrate_Loop(void);
+static void UartBaudrate_UartMessageHandler(struct UartFrameRxTxFrame *p_frame);
+static void UartBaudrate_ProcessModemStart(void);
+static void UartBaudrate_ProcessBaudrateSetResponse(struct UartFrameRxTxFrame *p_frame);
+static void UartBaudrate_ProcessPongResponse(struct UartFrameRxTxFrame *p_frame);
+static void UartBaudrate_SendPing(void);
+static void UartBaudrate_Revert(void);
+static void UartBaudrate_RestartModem(void);
+static void UartBaudrate_SetState(enum UartBaudrateState state);
+static bool UartBaudrate_IsSupported(uint32_t baudrate);
+
+static const uint32_t SupportedBaudrates[] = {115200, 230400, 460800};
+
+static const enum UartFrameCmd UartFrameCommandList[] = {
+    UART_FRAME_CMD_INIT_DEVICE_EVENT,
+    UART_FRAME_CMD_INIT_NODE_EVENT,
+    UART_FRAME_CMD_BAUDRATE_SET_RESP,
+    UART_FRAME_CMD_PONG_RESPONSE,
+};
+
+static struct UartProtocolHandlerConfig MessageHandlerConfig = {
+    .p_uart_message_handler       = UartBaudrate_UartMessageHandler,
+    .p_mesh_message_handler       = NULL,
+    .p_uart_frame_command_list    = UartFrameCommandList,
+    .p_mesh_message_opcode_list   = NULL,
+    .uart_frame_command_list_len  = ARRAY_SIZE(UartFrameCommandList),
+    .mesh_message_opcode_list_len = 0,
+    .instance_index               = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
+};
+
+static bool IsInitialized = false;
+
+static enum UartBaudrateState State             = UART_BAUDRATE_STATE_DEFAULT;
+static uint32_t               DefaultBaudrate   = 0;
+static uint32_t               RequestedBaudrate = 0;
+static uint32_t               StateTimestamp    = 0;
+static uint32_t               PingTimestamp     = 0;
+static uint32_t               PongTimestamp     = 0;
+static uint16_t               PingToken         = 0;
+
+void UartBaudrate_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("UartBaudrate initialization");
+
+    if (!UartProtocol_IsInitialized())
+    {
+        UartProtocol_Init();
+    }
+
+    // Modem always starts with the default baud rate
+    DefaultBaudrate = UartProtocol_GetBaudrate();
+
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig);
+
+    SimpleScheduler_TaskAdd(UART_BAUDRATE_TASK_PERIOD_MS, UartBaudrate_Loop, SIMPLE_SCHEDULER_TASK_ID_UART_BAUDRATE, true);
+
+    IsInitialized = true;
+}
+
+bool UartBaudrate_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+bool UartBaudrate_Negotiate(uint32_t baudrate)
+{
+    ASSERT(IsInitialized);
+
+    if (!UartBaudrate_IsSupported(baudrate) || (State == UART_BAUDRATE_STATE_REQUEST_SENT) || (State == UART_BAUDRATE_STATE_VERIFYING))
+    {
+        return false;
+    }
+
+    LOG_D("Baud rate set request: %u", (unsigned int)baudrate);
+
+    struct UartProtocolFrameBaudrateSetRequest request = {
+        .baudrate = baudrate,
+    };
+
+    RequestedBaudrate = baudrate;
+
+    UartProtocol_Send(UART_FRAME_CMD_BAUDRATE_SET_REQ, (uint8_t *)&request + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(request) - UART_PROTOCOL_FRAME_HEADER_LEN);
+
+    UartBaudrate_SetState(UART_BAUDRATE_STATE_REQUEST_SENT);
+
+    return true;
+}
+
+enum UartBaudrateState UartBaudrate_GetState(void)
+{
+    return State;
+}
+
+static void UartBaudrate_Loop(void)
+{
+    uint32_t current_time = Timestamp_GetCurrent();
+
+    switch (State)
+    {
+        case UART_BAUDRATE_STATE_START_PENDING:
+            if (Timestamp_GetTimeElapsed(StateTimestamp, current_time) >= UART_BAUDRATE_START_DELAY_MS)
+            {
+                UartBaudrate_SetState(UART_BAUDRATE_STATE_DEFAULT);
+                UartBaudrate_Negotiate(UART_BAUDRATE_TARGET);
+            }
+            break;
+
+        case UART_BAUDRATE_STATE_REQUEST_SENT:
+            if (Timestamp_GetTimeElapsed(StateTimestamp, current_time) >= UART_BAUDRATE_RESPONSE_TIMEOUT_MS)
+            {
+                // Baud rate was not changed, modem may not support the request
+                LOG_W("Baud rate set request timeout");
+                UartBaudrate_SetState((UartProtocol_GetBaudrate() == DefaultBaudrate) ? UART_BAUDRATE_STATE_DEFAULT : UART_BAUDRATE_STATE_ACTIVE);
+            }
+            break;
+
+        case UART_BAUDRATE_STATE_VERIFYING:
+            if (Timestamp_GetTimeElapsed(StateTimestamp, current_time) >= UART_BAUDRATE_VERIFY_TIMEOUT_MS)
+            {
+                LOG_W("Baud rate verification failed");
+                UartBaudrate_Revert();
+            }
+            else if (Timestamp_GetTimeElapsed(PingTimestamp, current_time) >= UART_BAUDRATE_VERIFY_PING_INTERVAL_MS)
+            {
+                UartBaudrate_SendPing();
+            }
+            break;
+
+        case UART_BAUDRATE_STATE_ACTIVE:
+            if (Timestamp_GetTimeElapsed(PongTimestamp, current_time) >= UART_BAUDRATE_KEEPALIVE_TIMEOUT_MS)
+            {
+                LOG_W("Baud rate link lost");
+                // Reset request is sent with the negotiated baud rate, the modem may still use it if only pongs were lost
+                UartBaudrate_RestartModem();
+                UartBaudrate_Revert();
+            }
+            else if (Timestamp_GetTimeElapsed(PingTimestamp, current_time) >= UART_BAUDRATE_KEEPALIVE_INTERVAL_MS)
+            {
+                UartBaudrate_SendPing();
+            }
+            break;
+
+        case UART_BAUDRATE_STATE_DEFAULT:
+        default:
+            break;
+    }
+}
+
+static void UartBaudrate_UartMessageHandler(struct UartFrameRxTxFrame *p_frame)
+{
+    ASSERT(p_frame != NULL);
+
+    switch (p_frame->cmd)
+    {
+        case UART_FRAME_CMD_INIT_DEVICE_EVENT:
+        case UART_FRAME_CMD_INIT_NODE_EVENT:
+            UartBaudrate_ProcessModemStart();
+            break;
+
+        case UART_FRAME_CMD_BAUDRATE_SET_RESP:
+            UartBaudrate_ProcessBaudrateSetResponse(p_frame);
+            break;
+
+        case UART_FRAME_CMD_PONG_RESPONSE:
+            UartBaudrate_ProcessPongResponse(p_frame);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void UartBaudrate_ProcessModemStart(void)
+{
+    // Init events are received also when the negotiated baud rate is used, e.g. after provisioning
+    if (State != UART_BAUDRATE_STATE_DEFAULT)
+    {
+        return;
+    }
+
+    UartBaudrate_SetState(UART_BAUDRATE_STATE_START_PENDING);
+}
+
+static void UartBaudrate_ProcessBaudrateSetResponse(struct UartFrameRxTxFrame *p_frame)
+{
+    struct UartProtocolFrameBaudrateSetResponse *p_response = (struct UartProtocolFrameBaudrateSetResponse *)p_frame;
+
+    if ((State != UART_BAUDRATE_STATE_REQUEST_SENT) || (p_frame->len != sizeof(struct UartProtocolFrameBaudrateSetResponse) - UART_PROTOCOL_FRAME_HEADER_LEN))
+    {
+        return;
+    }
+
+    if ((p_response->status != UART_PROTOCOL_BAUDRATE_SET_STATUS_ACCEPTED) || (p_response->baudrate != RequestedBaudrate))
+    {
+        LOG_W("Baud rate set request rejected");
+        UartBaudrate_SetState((UartProtocol_GetBaudrate() == DefaultBaudrate) ? UART_BAUDRATE_STATE_DEFAULT : UART_BAUDRATE_STATE_ACTIVE);
+        return;
+    }
+
+    // Modem switches right after the response, so the link is verified with the new baud rate
+    UartProtocol_SetBaudrate(RequestedBaudrate);
+
+    PingToken++;
+    UartBaudrate_SetState(UART_BAUDRATE_STATE_VERIFYING);
+    UartBaudrate_SendPing();
+}
+
+static void UartBaudrate_ProcessPongResponse(struct UartFrameRxTxFrame *p_frame)
+{
+    if ((p_frame->len != sizeof(PingToken)) || (p_frame->p_payload[0] != LOW_BYTE(PingToken)) || (p_frame->p_payload[1] != HIGH_BYTE(PingToken)))
+    {
+        return;
+    }
+
+    PongTimestamp = Timestamp_GetCurrent();
+
+    if (State == UART_BAUDRATE_STATE_VERIFYING)
+    {
+        LOG_D("Baud rate changed to %u", (unsigned int)RequestedBaudrate);
+        UartBaudrate_SetState(UART_BAUDRATE_STATE_ACTIVE);
+    }
+}
+
+static void UartBaudrate_SendPing(void)
+{
+    uint8_t payload[] = {LOW_BYTE(PingToken), HIGH_BYTE(PingToken)};
+
+    PingTimestamp = Timestamp_GetCurrent();
+
+    UartProtocol_Send(UART_FRAME_CMD_PING_REQUEST, payload, sizeof(payload));
+}
+
+static void UartBaudrate_Revert(void)
+{
+    LOG_W("Restoring default baud rate");
+
+    UartProtocol_SetBaudrate(DefaultBaudrate);
+    UartBaudrate_SetState(UART_BAUDRATE_STATE_DEFAULT);
+}
+
+// Modem state is unknown after the link loss, so the init handshake is run again from the modem reset
+static void UartBaudrate_RestartModem(void)
+{
+    LOG_W("Restarting modem");
+
+    UartProtocol_Send(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, NULL, 0);
+    UartProtocol_Flush();
+}
+
+static void UartBaudrate_SetState(enum UartBaudrateState state)
+{
+    State          = state;
+    StateTimestamp = Timestamp_GetCurrent();
+
+    if (state == UART_BAUDRATE_STATE_ACTIVE)
+    {
+        PongTimestamp = StateTimestamp;
+    }
+}
+
+static bool UartBaudrate_IsSupported(uint32_t baudrate)
+{
+    size_t i;
+    for (i = 0; i < ARRAY_SIZE(SupportedBaudrates); i++)
+    {
+        if (SupportedBaudrates[i] == baudrate)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,37 @@
+#ifndef UART_BAUDRATE_H
+#define UART_BAUDRATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define UART_BAUDRATE_TARGET 460800 /**< Baud rate negotiated after each modem start */
+
+enum UartBaudrateState
+{
+    UART_BAUDRATE_STATE_DEFAULT,
+    UART_BAUDRATE_STATE_START_PENDING,
+    UART_BAUDRATE_STATE_REQUEST_SENT,
+    UART_BAUDRATE_STATE_VERIFYING,
+    UART_BAUDRATE_STATE_ACTIVE,
+};
+
+// Initialize UART baud rate negotiation module.
+void UartBaudrate_Init(void);
+
+// Check if UART baud rate negotiation module is initialized.
+bool UartBaudrate_IsInitialized(void);
+
+/*
+ *  Start negotiation of the new baud rate with the modem. Both sides switch after the modem accepts
+ *  the request, then the link is verified with ping. Default baud rate is restored when the modem
+ *  does not respond. When the keepalive ping fails later, the modem is also restarted, so the init
+ *  handshake and the negotiation are run again.
+ *
+ *  @param baudrate         One of 115200, 230400 or 460800
+ *  @return                 True if negotiation has been started
+ */
+bool UartBaudrate_Negotiate(uint32_t baudrate);
+
+enum UartBaudrateState UartBaudrate_GetState(void);
+
+#endif    // UART_BAUDRATE_H
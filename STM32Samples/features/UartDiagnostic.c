@@ -0,0 +1,183 @@
+#include "UartDiagnostic.h"
+
+#include <stddef.h>
+
+#include "Assert.h"
+#include "Log.h"
+#include "UartProtocol.h"
+#include "Utils.h"
+
+static void UartDiagnostic_UartMessageHandler(struct UartFrameRxTxFrame *p_frame);
+static void UartDiagnostic_ProcessRxStatsRequest(struct UartFrameRxTxFrame *p_frame);
+static void UartDiagnostic_ProcessTxStatsRequest(struct UartFrameRxTxFrame *p_frame);
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void     UartDiagnostic_ProcessHandlerStatsRequest(struct UartFrameRxTxFrame *p_frame);
+static uint32_t UartDiagnostic_GetMeanTicks(const struct UartProtocolTicksStats *p_stats);
+#endif
+
+static bool IsInitialized = false;
+
+static const enum UartFrameCmd UartFrameCommandList[] = {
+    UART_FRAME_CMD_RX_STATS_REQ,
+    UART_FRAME_CMD_TX_STATS_REQ,
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    UART_FRAME_CMD_HANDLER_STATS_REQ,
+#endif
+};
+
+static struct UartProtocolHandlerConfig MessageHandlerConfig = {
+    .p_uart_message_handler       = UartDiagnostic_UartMessageHandler,
+    .p_mesh_message_handler       = NULL,
+    .p_uart_frame_command_list    = UartFrameCommandList,
+    .p_mesh_message_opcode_list   = NULL,
+    .uart_frame_command_list_len  = ARRAY_SIZE(UartFrameCommandList),
+    .mesh_message_opcode_list_len = 0,
+    .instance_index               = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
+};
+
+void UartDiagnostic_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("UartDiagnostic initialization");
+
+    if (!UartProtocol_IsInitialized())
+    {
+        UartProtocol_Init();
+    }
+
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig);
+
+    IsInitialized = true;
+}
+
+bool UartDiagnostic_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+static void UartDiagnostic_UartMessageHandler(struct UartFrameRxTxFrame *p_frame)
+{
+    ASSERT(p_frame != NULL);
+
+    switch (p_frame->cmd)
+    {
+        case UART_FRAME_CMD_RX_STATS_REQ:
+            UartDiagnostic_ProcessRxStatsRequest(p_frame);
+            break;
+
+        case UART_FRAME_CMD_TX_STATS_REQ:
+            UartDiagnostic_ProcessTxStatsRequest(p_frame);
+            break;
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+        case UART_FRAME_CMD_HANDLER_STATS_REQ:
+            UartDiagnostic_ProcessHandlerStatsRequest(p_frame);
+            break;
+#endif
+
+        default:
+            break;
+    }
+}
+
+static void UartDiagnostic_ProcessRxStatsRequest(struct UartFrameRxTxFrame *p_frame)
+{
+    struct UartProtocolFrameRxStatsRequest *p_request = (struct UartProtocolFrameRxStatsRequest *)p_frame;
+
+    if (p_frame->len != sizeof(struct UartProtocolFrameRxStatsRequest) - UART_PROTOCOL_FRAME_HEADER_LEN)
+    {
+        LOG_W("Invalid RX stats request length: %u", p_frame->len);
+        return;
+    }
+
+    struct UartFrameRxStats                 stats;
+    struct UartProtocolFrameRxStatsResponse response;
+
+    UartProtocol_GetRxStats(&stats);
+
+    response.bytes_cnt              = stats.bytes_cnt;
+    response.frames_cnt             = stats.frames_cnt;
+    response.crc_errors_cnt         = stats.crc_errors_cnt;
+    response.preamble_errors_cnt    = stats.preamble_errors_cnt;
+    response.length_errors_cnt      = stats.length_errors_cnt;
+    response.command_errors_cnt     = stats.command_errors_cnt;
+    response.overruns_cnt           = stats.overruns_cnt;
+    response.buffer_high_water_mark = stats.buffer_high_water_mark;
+    response.buffer_len             = stats.buffer_len;
+
+    if (p_request->clear == UART_PROTOCOL_RX_STATS_CLEAR)
+    {
+        UartProtocol_ClearRxStats();
+    }
+
+    UartProtocol_Send(UART_FRAME_CMD_RX_STATS_RESP, (uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN);
+}
+
+static void UartDiagnostic_ProcessTxStatsRequest(struct UartFrameRxTxFrame *p_frame)
+{
+    if (p_frame->len != 0)
+    {
+        LOG_W("Invalid TX stats request length: %u", p_frame->len);
+        return;
+    }
+
+    struct UartFrameTxStats                 stats;
+    struct UartProtocolFrameTxStatsResponse response;
+
+    UartProtocol_GetTxStats(&stats);
+
+    response.frames_cnt        = stats.frames_cnt;
+    response.dma_transfers_cnt = stats.dma_transfers_cnt;
+
+    UartProtocol_Send(UART_FRAME_CMD_TX_STATS_RESP, (uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN);
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void UartDiagnostic_ProcessHandlerStatsRequest(struct UartFrameRxTxFrame *p_frame)
+{
+    struct UartProtocolFrameHandlerStatsRequest *p_request = (struct UartProtocolFrameHandlerStatsRequest *)p_frame;
+
+    if (p_frame->len != sizeof(struct UartProtocolFrameHandlerStatsRequest) - UART_PROTOCOL_FRAME_HEADER_LEN)
+    {
+        LOG_W("Invalid handler stats request length: %u", p_frame->len);
+        return;
+    }
+
+    struct UartProtocolHandlerStats              stats    = {0};
+    struct UartProtocolFrameHandlerStatsResponse response = {0};
+
+    response.entry_index = p_request->entry_index;
+    response.entries_cnt = UartProtocol_GetHandlerStatsCnt();
+
+    // Entry index past the last entry is answered with zero calls, so the whole table can be read starting from index 0
+    if (UartProtocol_GetHandlerStats(p_request->entry_index, &stats))
+    {
+        response.handler_cmd        = stats.cmd;
+        response.mesh_opcode        = stats.mesh_opcode;
+        response.calls_cnt          = stats.handler.cnt;
+        response.handler_min_ticks  = stats.handler.min;
+        response.handler_max_ticks  = stats.handler.max;
+        response.handler_mean_ticks = UartDiagnostic_GetMeanTicks(&stats.handler);
+        response.latency_min_ticks  = stats.latency.min;
+        response.latency_max_ticks  = stats.latency.max;
+        response.latency_mean_ticks = UartDiagnostic_GetMeanTicks(&stats.latency);
+    }
+
+    if (p_request->clear == UART_PROTOCOL_HANDLER_STATS_CLEAR)
+    {
+        // Cleared statistics are kept in the log
+        UartProtocol_LogHandlerStats();
+        UartProtocol_ClearHandlerStats();
+    }
+
+    UartProtocol_Send(UART_FRAME_CMD_HANDLER_STATS_RESP,
+                      (uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN,
+                      sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN);
+}
+
+static uint32_t UartDiagnostic_GetMeanTicks(const struct UartProtocolTicksStats *p_stats)
+{
+    return (p_stats->cnt != 0) ? (uint32_t)(p_stats->sum / p_stats->cnt) : 0;
+}
+#endif
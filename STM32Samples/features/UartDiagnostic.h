@@ -0,0 +1,12 @@
+#ifndef UART_DIAGNOSTIC_H
+#define UART_DIAGNOSTIC_H
+
+#include <stdbool.h>
+
+// Initialize module responding to UART RX, TX and handler statistics requests.
+void UartDiagnostic_Init(void);
+
+// Check if UART diagnostic module is initialized.
+bool UartDiagnostic_IsInitialized(void);
+
+#endif    // UART_DIAGNOSTIC_H
@@ -4,8 +4,10 @@
 #include "Log.h"
 #include "Platform.h"
 #include "PriorityConfig.h"
+#include "Startup.h"
 #include "SystemHal.h"
 #include "Timestamp.h"
+#include "Utils.h"
 
 #define ADC_NUMBER_OF_SCAN_CHANNELS 5
 
@@ -26,28 +28,55 @@
 
 #define VREFINT_VOLTAGE_MV 1200
 
-static bool              IsInitialized = false;
+static bool              IsInitialized    = false;
+static bool              IsStartupPending = false;
 static volatile uint16_t AdcResults[ADC_NUMBER_OF_SCAN_CHANNELS];
 
 static void AdcHal_InitGpio(void);
 static void AdcHal_InitDma1Ch1(void);
 static void AdcHal_InitAdc1(void);
 static void AdcHal_InitTim4(void);
-static void AdcHal_WaitForInitializationDone(void);
+static bool AdcHal_StartCalibration(void);
+static bool AdcHal_IsCalibrationDone(void);
+static bool AdcHal_IsInitialMeasurementDone(void);
+
+static const struct StartupStep StartupSteps[] = {
+    // Delay between ADC enable and ADC start of calibration
+    {NULL, ADC_HAL_ENABLE_DELAY_MS},
+    {AdcHal_StartCalibration, 0},
+    {AdcHal_IsCalibrationDone, 0},
+    {AdcHal_IsInitialMeasurementDone, 0},
+};
+
+static const struct StartupSequence StartupSequence = {
+    .p_name    = "AdcHal",
+    .p_steps   = StartupSteps,
+    .steps_cnt = ARRAY_SIZE(StartupSteps),
+};
+
+static uint32_t CalibrationTimestamp = 0;
 
 void AdcHal_Init(void)
 {
     ASSERT(!IsInitialized);
 
+    if (IsStartupPending)
+    {
+        // Initialization has been started by another module, it is finished during the startup
+        return;
+    }
+
     LOG_D("AdcHal initialization");
 
     AdcHal_InitGpio();
     AdcHal_InitDma1Ch1();
     AdcHal_InitTim4();
     AdcHal_InitAdc1();
-    AdcHal_WaitForInitializationDone();
 
-    IsInitialized = true;
+    // Calibration and the initial measurement are done during the startup, ADC is initialized after them
+    Startup_AddSequence(&StartupSequence);
+
+    IsStartupPending = true;
 }
 
 bool AdcHal_IsInitialized(void)
@@ -171,25 +200,6 @@ static void AdcHal_InitAdc1(void)
     LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(ADC1), LL_ADC_PATH_INTERNAL_VREFINT);
 
     LL_ADC_Enable(ADC1);
-
-    // Delay between ADC enable and ADC start of calibration
-    Timestamp_DelayMs(ADC_HAL_ENABLE_DELAY_MS);
-
-    // Run ADC self calibration
-    LL_ADC_StartCalibration(ADC1);
-
-    // Poll for ADC effectively calibrated
-    uint32_t calib_timestamp = Timestamp_GetCurrent();
-    while (LL_ADC_IsCalibrationOnGoing(ADC1) != 0)
-    {
-        if (Timestamp_GetTimeElapsed(calib_timestamp, Timestamp_GetCurrent()) > ADC_HAL_CALIBRATION_TIMEOUT_MS)
-        {
-            // ADC calibration timeout - critical failure
-            ASSERT(false);
-        }
-    }
-
-    LL_ADC_REG_StartConversionExtTrig(ADC1, LL_ADC_REG_TRIG_EXT_RISING);
 }
 
 static void AdcHal_InitTim4(void)
@@ -219,10 +229,45 @@ static void AdcHal_InitTim4(void)
     LL_TIM_EnableCounter(TIM4);
 }
 
-static void AdcHal_WaitForInitializationDone(void)
+static bool AdcHal_StartCalibration(void)
 {
-    while (LL_DMA_IsActiveFlag_TC1(DMA1) == 0)
+    // Run ADC self calibration
+    LL_ADC_StartCalibration(ADC1);
+
+    CalibrationTimestamp = Timestamp_GetCurrent();
+
+    return true;
+}
+
+static bool AdcHal_IsCalibrationDone(void)
+{
+    // Poll for ADC effectively calibrated
+    if (LL_ADC_IsCalibrationOnGoing(ADC1) != 0)
     {
-        // Wait for DMA transfer complete
+        if (Timestamp_GetTimeElapsed(CalibrationTimestamp, Timestamp_GetCurrent()) > ADC_HAL_CALIBRATION_TIMEOUT_MS)
+        {
+            // ADC calibration timeout - critical failure
+            ASSERT(false);
+        }
+
+        return false;
     }
+
+    LL_ADC_REG_StartConversionExtTrig(ADC1, LL_ADC_REG_TRIG_EXT_RISING);
+
+    return true;
+}
+
+static bool AdcHal_IsInitialMeasurementDone(void)
+{
+    // Wait for DMA transfer complete
+    if (LL_DMA_IsActiveFlag_TC1(DMA1) == 0)
+    {
+        return false;
+    }
+
+    IsStartupPending = false;
+    IsInitialized    = true;
+
+    return true;
 }
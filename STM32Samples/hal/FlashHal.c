@@ -6,6 +6,7 @@
 #include "AtomicHal.h"
 #include "Log.h"
 #include "Platform.h"
+#include "Startup.h"
 #include "Utils.h"
 
 #define FLASH_HAL_PAGE_ERASE_TIMEOUT 0x00000FFF
@@ -45,7 +46,7 @@ RAM_FUNCTION static void FlashHal_Lock(void);
 
 RAM_FUNCTION static void FlashHal_BlockingDelay(void);
 
-static bool FlashHal_CheckIsSpaceBlank(void);
+static bool FlashHal_CheckIsPageBlank(uint32_t page_address);
 
 extern uint32_t _flash_start;
 extern uint32_t _flash_end;
@@ -57,6 +58,17 @@ extern uint32_t _image_size;
 
 static bool IsInitialized = false;
 
+// One page is erased per step, so erasing overlaps with other startup sequences
+static const struct StartupStep StartupSteps[] = {
+    {FlashHal_EraseSpacePage, 0},
+};
+
+static const struct StartupSequence StartupSequence = {
+    .p_name    = "FlashHal",
+    .p_steps   = StartupSteps,
+    .steps_cnt = ARRAY_SIZE(StartupSteps),
+};
+
 void FlashHal_Init(void)
 {
     ASSERT(!IsInitialized);
@@ -65,7 +77,7 @@ void FlashHal_Init(void)
 
     // Erase only if not blank. Erase take more than 100ms so it is better to clean Space during startup than blocking
     // code execution for more than 100ms during normal run run. It is important for DFU where erase is call
-    FlashHal_EraseSpace();
+    Startup_AddSequence(&StartupSequence);
 
     IsInitialized = true;
 }
@@ -93,27 +105,37 @@ uint32_t FlashHal_GetSpaceAddress(void)
 
 bool FlashHal_EraseSpace(void)
 {
-    if (FlashHal_CheckIsSpaceBlank())
+    while (!FlashHal_EraseSpacePage())
     {
-        return true;
+        // Erase space page by page
     }
 
-    uint32_t space_page_addess = FlashHal_GetSpaceAddress();
+    return true;
+}
 
-    FlashHal_Unlock();
+bool FlashHal_EraseSpacePage(void)
+{
+    uint32_t space_page_addess = FlashHal_GetSpaceAddress();
 
-    // Erase space page by page
-    while (space_page_addess < FLASH_HAL_FLASH_END_ADDRESS)
+    // Blank pages are skipped
+    while ((space_page_addess < FLASH_HAL_FLASH_END_ADDRESS) && FlashHal_CheckIsPageBlank(space_page_addess))
     {
-        enum FlashHalStatus status = FlashHal_ErasePage(space_page_addess);
-        ASSERT(status == FLASH_HAL_STATUS_COMPLETE);
-
         space_page_addess += FLASH_HAL_PAGE_SIZE;
     }
 
+    if (space_page_addess >= FLASH_HAL_FLASH_END_ADDRESS)
+    {
+        return true;
+    }
+
+    FlashHal_Unlock();
+
+    enum FlashHalStatus status = FlashHal_ErasePage(space_page_addess);
+    ASSERT(status == FLASH_HAL_STATUS_COMPLETE);
+
     FlashHal_Lock();
 
-    return true;
+    return false;
 }
 
 bool FlashHal_SaveToFlash(uint32_t address, const uint32_t *p_src, uint32_t num_of_words)
@@ -287,18 +309,18 @@ static void FlashHal_BlockingDelay(void)
     }
 }
 
-static bool FlashHal_CheckIsSpaceBlank(void)
+static bool FlashHal_CheckIsPageBlank(uint32_t page_address)
 {
-    uint32_t space_page_addess = FlashHal_GetSpaceAddress();
+    uint32_t page_end_address = page_address + FLASH_HAL_PAGE_SIZE;
 
-    while (space_page_addess < FLASH_HAL_FLASH_END_ADDRESS)
+    while (page_address < page_end_address)
     {
-        if (*(uint32_t *)space_page_addess != FLASH_HAL_BLANK_WORD)
+        if (*(uint32_t *)page_address != FLASH_HAL_BLANK_WORD)
         {
             return false;
         }
 
-        space_page_addess += sizeof(uint32_t);
+        page_address += sizeof(uint32_t);
     }
     return true;
 }
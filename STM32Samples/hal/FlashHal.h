@@ -17,6 +17,13 @@ uint32_t FlashHal_GetSpaceAddress(void);
 
 bool FlashHal_EraseSpace(void);
 
+/*
+ *  Erase the next page of the space which is not blank
+ *
+ *  @return   True if the whole space is blank
+ */
+bool FlashHal_EraseSpacePage(void);
+
 bool FlashHal_SaveToFlash(uint32_t address, const uint32_t *p_src, uint32_t num_of_words);
 
 RAM_FUNCTION bool FlashHal_UpdateFirmware(uint32_t num_of_words);
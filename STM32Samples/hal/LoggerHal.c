@@ -18,7 +18,9 @@ static bool IsInitialized = false;
 static volatile uint8_t DmaTxBuffer[LOGGER_HAL_TX_BUFFER_LEN];
 static volatile uint8_t DmaRxBuffer[LOGGER_HAL_RX_BUFFER_LEN];
 
-static volatile struct RingBuffer TxDmaBuffer;
+// Logs are written also from interrupts, so producers are serialized with critical section.
+// The only consumer is the DMA interrupt, or the flush with the interrupt disabled.
+static struct RingBuffer TxDmaBuffer;
 
 static volatile uint16_t CurrentTxTransferLen = 0;
 static volatile bool     isFlushInProgress    = false;
@@ -60,18 +62,20 @@ void LoggerHal_SendBuffer(uint8_t *p_buff, size_t buff_len)
 {
     ASSERT(p_buff != NULL);
 
-    if (RingBuffer_DataLen(&TxDmaBuffer) + buff_len > LOGGER_HAL_TX_BUFFER_LEN)
-    {
-        return;
-    }
+    struct RingBufferSpan span;
 
     Atomic_CriticalEnter();
 
-    if (!RingBuffer_QueueBytes(&TxDmaBuffer, p_buff, buff_len))
+    // Log is queued as a continuous record, so it is never split between DMA transfers
+    if (!RingBuffer_ReserveContinuous(&TxDmaBuffer, buff_len, &span))
     {
-        ASSERT(false);
+        Atomic_CriticalExit();
+        return;
     }
 
+    memcpy(span.p_buf, p_buff, buff_len);
+    RingBuffer_CommitContinuous(&TxDmaBuffer, &span);
+
     if (LL_DMA_IsEnabledChannel(DMA1, LL_DMA_CHANNEL_2) == 0)
     {
         LoggerHal_DmaStartNextTxTransfer();
@@ -128,26 +132,29 @@ void LoggerHal_Flush(void)
         LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_2);
     }
 
-    uint8_t tx_byte;
-    bool    status;
-    while (true)
-    {
-        Atomic_CriticalEnter();
-        status = RingBuffer_DequeueByte(&TxDmaBuffer, &tx_byte);
-        Atomic_CriticalExit();
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+    uint16_t              tx_len;
+    size_t                i;
+    size_t                j;
 
-        if (!status)
-        {
-            break;
-        }
-
-        // Wait for TXE flag to be raised
-        while (!LL_USART_IsActiveFlag_TXE(USART3))
+    // Logs can be queued from interrupts during the flush, they are sent as well
+    while ((tx_len = RingBuffer_GetReadSpans(&TxDmaBuffer, spans)) != 0)
+    {
+        for (i = 0; i < RING_BUFFER_SPANS_CNT; i++)
         {
+            for (j = 0; j < spans[i].len; j++)
+            {
+                // Wait for TXE flag to be raised
+                while (!LL_USART_IsActiveFlag_TXE(USART3))
+                {
+                }
+
+                // Write character in Transmit Data register
+                LL_USART_TransmitData8(USART3, spans[i].p_buf[j]);
+            }
         }
 
-        // Write character in Transmit Data register
-        LL_USART_TransmitData8(USART3, tx_byte);
+        RingBuffer_IncrementRdIndex(&TxDmaBuffer, tx_len);
     }
 
     isFlushInProgress = false;
@@ -287,11 +294,12 @@ void DMA1_Channel2_IRQHandler(void)
     {
         LL_DMA_ClearFlag_TC2(DMA1);
 
-        Atomic_CriticalEnter();
-
         RingBuffer_IncrementRdIndex(&TxDmaBuffer, CurrentTxTransferLen);
         CurrentTxTransferLen = 0;
 
+        // Log written from a higher priority interrupt starts the transfer when the channel is disabled
+        Atomic_CriticalEnter();
+
         // Disable DMA Channel TX
         LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_2);
 
@@ -1,7 +1,7 @@
 #ifndef PLATFORM_H
 #define PLATFORM_H
 
-#ifndef CMAKE_UNIT_TEST
+#if !defined(CMAKE_UNIT_TEST) && !defined(POSIX_HOST)
 #include "stm32f1xx.h"
 #include "stm32f1xx_conf.h"
 #endif
@@ -8,6 +8,8 @@
 
 // UartHal
 #define DMA1_CH7_UART_TX_IRQ_PRIORITY 7
+#define DMA1_CH6_UART_RX_IRQ_PRIORITY 7
+#define USART2_IRQ_PRIORITY 7
 
 // I2cHal
 #define I2C1_IRQ_PRIORITY 9
@@ -8,28 +8,65 @@
 #include "Platform.h"
 #include "PriorityConfig.h"
 #include "RingBuffer.h"
-
-#define UART_HAL_BAUDRATE 57600
+#include "SystemHal.h"
+#include "TickHal.h"
 
 #define UART_HAL_RX_BUFFER_LEN 512
+#define UART_HAL_RX_BUFFER_HALF_LEN (UART_HAL_RX_BUFFER_LEN / 2)
 #define UART_HAL_TX_BUFFER_LEN 1024
+#define UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN 256
+
+// Coalesced data is sent immediately when it fills this part of the TX buffer
+#define UART_HAL_TX_COALESCING_THRESHOLD (UART_HAL_TX_BUFFER_LEN / 2)
+
+#define UART_HAL_US_IN_SECOND 1000000
 
 static bool IsInitialized = false;
 
+static uint32_t Baudrate = UART_HAL_DEFAULT_BAUDRATE;
+
 static volatile uint8_t DmaTxBuffer[UART_HAL_TX_BUFFER_LEN];
+static volatile uint8_t DmaTxHighPriorityBuffer[UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN];
 static volatile uint8_t DmaRxBuffer[UART_HAL_RX_BUFFER_LEN];
 
-static volatile struct RingBuffer TxDmaBuffer;
+// Indexed with enum UartHalTxPriority, the first non-empty buffer is sent. Data is queued only from the main loop
+// and read by the DMA interrupt, so buffers are accessed without critical section.
+static struct RingBuffer TxDmaBuffers[UART_HAL_TX_PRIORITIES_CNT];
+
+// Buffer of the ongoing DMA transfer
+static struct RingBuffer *CurrentTxDmaBuffer = NULL;
+
+static uint32_t DmaRxReadPtr = 0;
+
+static volatile uint32_t DmaRxHalfTransferCnt = 0;
+static uint32_t          DmaRxReadCnt         = 0;
+static uint32_t          RxBytesCntOffset     = 0;
+static uint32_t          RxOverrunsCnt        = 0;
+static uint16_t          RxHighWaterMark      = 0;
 
 static volatile uint16_t CurrentTxTransferLen = 0;
 static volatile bool     isFlushInProgress    = false;
 
+static bool     IsTxCoalescingEnabled   = false;
+static bool     IsTxPending             = false;
+static uint32_t TxCoalescingWindowTicks = 0;
+static uint32_t TxPendingStartTick      = 0;
+static uint32_t TxDmaTransfersCnt       = 0;
+
+static void (*RxDataIrqCb)(void) = NULL;
+
 static void UartHal_InitGpio(void);
 static void UartHal_InitDma1Ch6Ch7(void);
 static void UartHal_InitNvic(void);
 static void UartHal_InitUart2(void);
 
-static void UartHal_DmaStartNextTxTransfer(void);
+static void     UartHal_DmaStartNextTxTransfer(void);
+static void     UartHal_TxStart(enum UartHalTxPriority priority);
+static uint32_t UartHal_GetRxWrittenCnt(uint32_t *p_dma_write_ptr);
+static void     UartHal_UpdateRxStats(void);
+static void UartHal_RxDataIrqNotify(void);
+
+static struct RingBuffer *UartHal_GetNextTxDmaBuffer(void);
 
 void UartHal_Init(void)
 {
@@ -37,7 +74,8 @@ void UartHal_Init(void)
 
     LOG_D("UartHal initialization");
 
-    RingBuffer_Init(&TxDmaBuffer, DmaTxBuffer, UART_HAL_TX_BUFFER_LEN);
+    RingBuffer_Init(&TxDmaBuffers[UART_HAL_TX_PRIORITY_HIGH], DmaTxHighPriorityBuffer, UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN);
+    RingBuffer_Init(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], DmaTxBuffer, UART_HAL_TX_BUFFER_LEN);
 
     UartHal_InitGpio();
     UartHal_InitDma1Ch6Ch7();
@@ -63,18 +101,23 @@ void UartHal_SendBuffer(uint8_t *p_buff, size_t buff_len)
 {
     ASSERT(p_buff != NULL);
 
-    Atomic_CriticalEnter();
+    struct RingBufferSpan span;
 
-    if (!RingBuffer_QueueBytes(&TxDmaBuffer, p_buff, buff_len))
+    // Buffer is queued as a continuous record, so it is never split between DMA transfers
+    if (!RingBuffer_ReserveContinuous(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], buff_len, &span))
     {
         ASSERT(false);
     }
-
-    if (LL_DMA_IsEnabledChannel(DMA1, LL_DMA_CHANNEL_7) == 0)
+    else
     {
-        UartHal_DmaStartNextTxTransfer();
+        memcpy(span.p_buf, p_buff, buff_len);
+        RingBuffer_CommitContinuous(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], &span);
     }
 
+    Atomic_CriticalEnter();
+
+    UartHal_TxStart(UART_HAL_TX_PRIORITY_NORMAL);
+
     Atomic_CriticalExit();
 }
 
@@ -83,19 +126,119 @@ void UartHal_SendByte(uint8_t byte)
     UartHal_SendBuffer(&byte, 1);
 }
 
+bool UartHal_TxReserve(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation)
+{
+    ASSERT((p_reservation != NULL) && (priority < UART_HAL_TX_PRIORITIES_CNT));
+
+    p_reservation->priority = priority;
+
+    if (!RingBuffer_ReserveContinuous(&TxDmaBuffers[priority], len, &p_reservation->spans[0]))
+    {
+        return false;
+    }
+
+    p_reservation->spans[1].p_buf = p_reservation->spans[0].p_buf;
+    p_reservation->spans[1].len   = 0;
+
+    return true;
+}
+
+void UartHal_TxCommit(struct UartHalTxReservation *p_reservation)
+{
+    ASSERT(p_reservation != NULL);
+
+    RingBuffer_CommitContinuous(&TxDmaBuffers[p_reservation->priority], &p_reservation->spans[0]);
+
+    Atomic_CriticalEnter();
+
+    UartHal_TxStart(p_reservation->priority);
+
+    Atomic_CriticalExit();
+}
+
+uint16_t UartHal_GetTxFreeSpace(enum UartHalTxPriority priority)
+{
+    ASSERT(priority < UART_HAL_TX_PRIORITIES_CNT);
+
+    return RingBuffer_GetMaxContinuousFreeLen(&TxDmaBuffers[priority]);
+}
+
+void UartHal_SetTxCoalescing(bool is_enable, uint32_t window_us)
+{
+    Atomic_CriticalEnter();
+
+    IsTxCoalescingEnabled   = is_enable;
+    TxCoalescingWindowTicks = (SystemHal_GetCoreClock() / UART_HAL_US_IN_SECOND) * window_us;
+
+    if (!is_enable && IsTxPending && (LL_DMA_IsEnabledChannel(DMA1, LL_DMA_CHANNEL_7) == 0))
+    {
+        UartHal_DmaStartNextTxTransfer();
+    }
+
+    Atomic_CriticalExit();
+}
+
+void UartHal_ProcessPendingTx(void)
+{
+    Atomic_CriticalEnter();
+
+    if (IsTxPending && (LL_DMA_IsEnabledChannel(DMA1, LL_DMA_CHANNEL_7) == 0) &&
+        ((TickHal_GetClockTick() - TxPendingStartTick) >= TxCoalescingWindowTicks))
+    {
+        UartHal_DmaStartNextTxTransfer();
+    }
+
+    Atomic_CriticalExit();
+}
+
+uint32_t UartHal_GetTxDmaTransfersCnt(void)
+{
+    return TxDmaTransfersCnt;
+}
+
+void UartHal_SetBaudrate(uint32_t baudrate)
+{
+    ASSERT(IsInitialized && (baudrate != 0));
+
+    // Data queued with the previous baud rate has to be sent before the change
+    UartHal_Flush();
+
+    while (!LL_USART_IsActiveFlag_TC(USART2))
+    {
+        // Wait until the last byte is shifted out
+    }
+
+    LL_RCC_ClocksTypeDef rcc_clocks;
+    LL_RCC_GetSystemClocksFreq(&rcc_clocks);
+
+    LL_USART_Disable(USART2);
+    LL_USART_SetBaudRate(USART2, rcc_clocks.PCLK1_Frequency, baudrate);
+    LL_USART_Enable(USART2);
+
+    Baudrate = baudrate;
+
+    LOG_D("UartHal baud rate: %u", (unsigned int)baudrate);
+}
+
+uint32_t UartHal_GetBaudrate(void)
+{
+    return Baudrate;
+}
+
 bool UartHal_ReadByte(uint8_t *p_byte)
 {
     ASSERT(p_byte != NULL);
 
-    static uint32_t dma_read_ptr = 0;
+    UartHal_UpdateRxStats();
 
-    if (UART_HAL_RX_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_6) != dma_read_ptr)
+    if (UART_HAL_RX_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_6) != DmaRxReadPtr)
     {
-        *p_byte = DmaRxBuffer[dma_read_ptr];
-        dma_read_ptr++;
-        if (dma_read_ptr == UART_HAL_RX_BUFFER_LEN)
+        *p_byte = DmaRxBuffer[DmaRxReadPtr];
+        DmaRxReadPtr++;
+        DmaRxReadCnt++;
+        if (DmaRxReadPtr == UART_HAL_RX_BUFFER_LEN)
         {
-            dma_read_ptr = 0;
+            DmaRxReadPtr = 0;
         }
         return true;
     }
@@ -103,6 +246,91 @@ bool UartHal_ReadByte(uint8_t *p_byte)
     return false;
 }
 
+bool UartHal_IsRxDataAvailable(void)
+{
+    return (UART_HAL_RX_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_6)) != DmaRxReadPtr;
+}
+
+void UartHal_SetRxDataIrq(void (*irq_cb)(void))
+{
+    NVIC_DisableIRQ(DMA1_Channel6_IRQn);
+    NVIC_DisableIRQ(USART2_IRQn);
+
+    RxDataIrqCb = irq_cb;
+
+    // RX DMA half and full transfer interrupts are always enabled, they are used for the overrun detection
+    NVIC_EnableIRQ(DMA1_Channel6_IRQn);
+
+    if (irq_cb == NULL)
+    {
+        LL_USART_DisableIT_IDLE(USART2);
+        return;
+    }
+
+    LL_USART_ClearFlag_IDLE(USART2);
+
+    // Idle line signals end of the burst, half and full transfer interrupts cover bursts longer than the RX buffer
+    LL_USART_EnableIT_IDLE(USART2);
+
+    NVIC_EnableIRQ(USART2_IRQn);
+}
+
+void UartHal_GetRxStats(struct UartHalRxStats *p_stats)
+{
+    ASSERT(p_stats != NULL);
+
+    UartHal_UpdateRxStats();
+
+    uint32_t dma_write_ptr;
+
+    p_stats->bytes_cnt       = UartHal_GetRxWrittenCnt(&dma_write_ptr) - RxBytesCntOffset;
+    p_stats->overruns_cnt    = RxOverrunsCnt;
+    p_stats->high_water_mark = RxHighWaterMark;
+    p_stats->buffer_len      = UART_HAL_RX_BUFFER_LEN;
+}
+
+void UartHal_ClearRxStats(void)
+{
+    uint32_t dma_write_ptr;
+
+    RxBytesCntOffset = UartHal_GetRxWrittenCnt(&dma_write_ptr);
+    RxOverrunsCnt    = 0;
+    RxHighWaterMark  = 0;
+}
+
+uint8_t *UartHal_GetRxMaxContinuousBuffer(uint16_t *p_buf_len)
+{
+    ASSERT(p_buf_len != NULL);
+
+    UartHal_UpdateRxStats();
+
+    uint32_t dma_write_ptr = UART_HAL_RX_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_6);
+
+    if (dma_write_ptr >= DmaRxReadPtr)
+    {
+        *p_buf_len = dma_write_ptr - DmaRxReadPtr;
+    }
+    else
+    {
+        // DMA write pointer has wrapped around, return data up to the end of the buffer
+        *p_buf_len = UART_HAL_RX_BUFFER_LEN - DmaRxReadPtr;
+    }
+
+    return &DmaRxBuffer[DmaRxReadPtr];
+}
+
+void UartHal_IncrementRxRdIndex(uint16_t value)
+{
+    ASSERT(value <= UART_HAL_RX_BUFFER_LEN);
+
+    DmaRxReadPtr += value;
+    DmaRxReadCnt += value;
+    if (DmaRxReadPtr >= UART_HAL_RX_BUFFER_LEN)
+    {
+        DmaRxReadPtr -= UART_HAL_RX_BUFFER_LEN;
+    }
+}
+
 void UartHal_Flush(void)
 {
     // To be sure that during the flush all DMA transfer is completed and
@@ -119,7 +347,7 @@ void UartHal_Flush(void)
         }
         LL_DMA_ClearFlag_TC7(DMA1);
 
-        RingBuffer_IncrementRdIndex(&TxDmaBuffer, CurrentTxTransferLen);
+        RingBuffer_IncrementRdIndex(CurrentTxDmaBuffer, CurrentTxTransferLen);
         CurrentTxTransferLen = 0;
 
         // Disable DMA Channel TX
@@ -127,29 +355,34 @@ void UartHal_Flush(void)
     }
 
 
-    uint8_t tx_byte;
-    bool    status;
-    while (true)
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+    size_t                priority;
+    size_t                i;
+    size_t                j;
+    for (priority = UART_HAL_TX_PRIORITY_HIGH; priority < UART_HAL_TX_PRIORITIES_CNT; priority++)
     {
-        Atomic_CriticalEnter();
-        status = RingBuffer_DequeueByte(&TxDmaBuffer, &tx_byte);
-        Atomic_CriticalExit();
-
-        if (!status)
-        {
-            break;
-        }
+        // Lower priority buffer is sent after the higher one is empty
+        uint16_t tx_len = RingBuffer_GetReadSpans(&TxDmaBuffers[priority], spans);
 
-        // Wait for TXE flag to be raised
-        while (!LL_USART_IsActiveFlag_TXE(USART2))
+        for (i = 0; i < RING_BUFFER_SPANS_CNT; i++)
         {
+            for (j = 0; j < spans[i].len; j++)
+            {
+                // Wait for TXE flag to be raised
+                while (!LL_USART_IsActiveFlag_TXE(USART2))
+                {
+                }
+
+                // Write character in Transmit Data register
+                LL_USART_TransmitData8(USART2, spans[i].p_buf[j]);
+            }
         }
 
-        // Write character in Transmit Data register
-        LL_USART_TransmitData8(USART2, tx_byte);
+        RingBuffer_IncrementRdIndex(&TxDmaBuffers[priority], tx_len);
     }
 
     isFlushInProgress = false;
+    IsTxPending       = false;
 
     NVIC_EnableIRQ(DMA1_Channel7_IRQn);
 }
@@ -197,6 +430,10 @@ static void UartHal_InitDma1Ch6Ch7(void)
 
     LL_DMA_SetDataLength(DMA1, LL_DMA_CHANNEL_6, UART_HAL_RX_BUFFER_LEN);
 
+    // Enable DMA1 CH6 half and full transfer interrupts
+    LL_DMA_EnableIT_HT(DMA1, LL_DMA_CHANNEL_6);
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_CHANNEL_6);
+
     // Enable DMA Channel RX
     LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_6);
 
@@ -217,6 +454,12 @@ static void UartHal_InitNvic(void)
 {
     NVIC_SetPriority(DMA1_Channel7_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), DMA1_CH7_UART_TX_IRQ_PRIORITY, 0));
     NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+
+    NVIC_SetPriority(DMA1_Channel6_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), DMA1_CH6_UART_RX_IRQ_PRIORITY, 0));
+    NVIC_EnableIRQ(DMA1_Channel6_IRQn);
+
+    // Idle line interrupt is enabled when RX data callback is set
+    NVIC_SetPriority(USART2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), USART2_IRQ_PRIORITY, 0));
 }
 
 static void UartHal_InitUart2(void)
@@ -226,7 +469,7 @@ static void UartHal_InitUart2(void)
 
     LL_USART_InitTypeDef usart_init = {0};
 
-    usart_init.BaudRate            = UART_HAL_BAUDRATE;
+    usart_init.BaudRate            = Baudrate;
     usart_init.DataWidth           = LL_USART_DATAWIDTH_8B;
     usart_init.StopBits            = LL_USART_STOPBITS_1;
     usart_init.Parity              = LL_USART_PARITY_NONE;
@@ -243,6 +486,29 @@ static void UartHal_InitUart2(void)
     LL_USART_Enable(USART2);
 }
 
+static void UartHal_TxStart(enum UartHalTxPriority priority)
+{
+    if (LL_DMA_IsEnabledChannel(DMA1, LL_DMA_CHANNEL_7) != 0)
+    {
+        // Queued data is sent after the current transfer, together with data queued in the meantime
+        return;
+    }
+
+    if (IsTxCoalescingEnabled && (priority != UART_HAL_TX_PRIORITY_HIGH) &&
+        (RingBuffer_DataLen(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL]) < UART_HAL_TX_COALESCING_THRESHOLD))
+    {
+        // Transfer is started by UartHal_ProcessPendingTx, so more data can be sent with a single DMA transfer
+        if (!IsTxPending)
+        {
+            IsTxPending        = true;
+            TxPendingStartTick = TickHal_GetClockTick();
+        }
+        return;
+    }
+
+    UartHal_DmaStartNextTxTransfer();
+}
+
 static void UartHal_DmaStartNextTxTransfer(void)
 {
     if (isFlushInProgress)
@@ -250,12 +516,23 @@ static void UartHal_DmaStartNextTxTransfer(void)
         return;
     }
 
-    uint8_t *p_tx_begin_pointer = RingBuffer_GetMaxContinuousBuffer(&TxDmaBuffer, &CurrentTxTransferLen);
+    IsTxPending = false;
+
+    struct RingBuffer *p_tx_dma_buffer = UartHal_GetNextTxDmaBuffer();
+    if (p_tx_dma_buffer == NULL)
+    {
+        return;
+    }
+
+    CurrentTxDmaBuffer          = p_tx_dma_buffer;
+    uint8_t *p_tx_begin_pointer = RingBuffer_GetMaxContinuousBuffer(CurrentTxDmaBuffer, &CurrentTxTransferLen);
     if (CurrentTxTransferLen == 0)
     {
         return;
     }
 
+    TxDmaTransfersCnt++;
+
     // Clear Global IRQ flag
     LL_DMA_ClearFlag_GI7(DMA1);
 
@@ -286,19 +563,98 @@ void DMA1_Channel7_IRQHandler(void)
     {
         LL_DMA_ClearFlag_TC7(DMA1);
 
-        Atomic_CriticalEnter();
-
-        RingBuffer_IncrementRdIndex(&TxDmaBuffer, CurrentTxTransferLen);
+        // Transfer is started from the main loop only within critical section, so it is not needed in the interrupt
+        RingBuffer_IncrementRdIndex(CurrentTxDmaBuffer, CurrentTxTransferLen);
         CurrentTxTransferLen = 0;
 
         // Disable DMA Channel TX
         LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_7);
 
-        if (!RingBuffer_IsEmpty(&TxDmaBuffer))
+        if (UartHal_GetNextTxDmaBuffer() != NULL)
         {
             UartHal_DmaStartNextTxTransfer();
         }
+    }
+}
+
+static struct RingBuffer *UartHal_GetNextTxDmaBuffer(void)
+{
+    size_t i;
+    for (i = 0; i < UART_HAL_TX_PRIORITIES_CNT; i++)
+    {
+        if (!RingBuffer_IsEmpty(&TxDmaBuffers[i]))
+        {
+            return &TxDmaBuffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t UartHal_GetRxWrittenCnt(uint32_t *p_dma_write_ptr)
+{
+    // Transfers counter has to be read before the DMA position, the difference between them is then always shorter than the buffer
+    uint32_t half_transfer_cnt = DmaRxHalfTransferCnt;
+    uint32_t dma_write_ptr     = UART_HAL_RX_BUFFER_LEN - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_6);
+    uint32_t last_transfer_ptr = (half_transfer_cnt * UART_HAL_RX_BUFFER_HALF_LEN) % UART_HAL_RX_BUFFER_LEN;
+
+    *p_dma_write_ptr = dma_write_ptr;
+
+    return half_transfer_cnt * UART_HAL_RX_BUFFER_HALF_LEN + (dma_write_ptr + UART_HAL_RX_BUFFER_LEN - last_transfer_ptr) % UART_HAL_RX_BUFFER_LEN;
+}
+
+static void UartHal_UpdateRxStats(void)
+{
+    uint32_t dma_write_ptr;
+    uint32_t unread_cnt = UartHal_GetRxWrittenCnt(&dma_write_ptr) - DmaRxReadCnt;
 
-        Atomic_CriticalExit();
+    if (unread_cnt >= UART_HAL_RX_BUFFER_LEN)
+    {
+        // DMA has overwritten data which was not read, drop the whole buffer content
+        RxOverrunsCnt++;
+        RxHighWaterMark = UART_HAL_RX_BUFFER_LEN;
+        DmaRxReadPtr    = dma_write_ptr;
+        DmaRxReadCnt += unread_cnt;
+        return;
+    }
+
+    if (unread_cnt > RxHighWaterMark)
+    {
+        RxHighWaterMark = unread_cnt;
+    }
+}
+
+static void UartHal_RxDataIrqNotify(void)
+{
+    if (RxDataIrqCb != NULL)
+    {
+        RxDataIrqCb();
+    }
+}
+
+void DMA1_Channel6_IRQHandler(void)
+{
+    if (LL_DMA_IsActiveFlag_HT6(DMA1))
+    {
+        LL_DMA_ClearFlag_HT6(DMA1);
+        DmaRxHalfTransferCnt++;
+        UartHal_RxDataIrqNotify();
+    }
+
+    if (LL_DMA_IsActiveFlag_TC6(DMA1))
+    {
+        LL_DMA_ClearFlag_TC6(DMA1);
+        DmaRxHalfTransferCnt++;
+        UartHal_RxDataIrqNotify();
+    }
+}
+
+void USART2_IRQHandler(void)
+{
+    if (LL_USART_IsEnabledIT_IDLE(USART2) && LL_USART_IsActiveFlag_IDLE(USART2))
+    {
+        // Received data is already moved by DMA, so reading data register to clear the flag does not lose any byte
+        LL_USART_ClearFlag_IDLE(USART2);
+        UartHal_RxDataIrqNotify();
     }
 }
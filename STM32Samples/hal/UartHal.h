@@ -5,18 +5,143 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "RingBuffer.h"
+
+#define UART_HAL_DEFAULT_BAUDRATE 57600
+
+struct UartHalRxStats
+{
+    uint32_t bytes_cnt;       /**< Bytes written to the RX buffer by DMA */
+    uint32_t overruns_cnt;    /**< Number of times DMA has overwritten unread data */
+    uint16_t high_water_mark; /**< The highest number of unread bytes in the RX buffer */
+    uint16_t buffer_len;      /**< RX buffer size */
+};
+
+enum UartHalTxPriority
+{
+    UART_HAL_TX_PRIORITY_HIGH,   /**< Control traffic, e.g. DFU, provisioning and ping, sent before normal priority data */
+    UART_HAL_TX_PRIORITY_NORMAL, /**< Bulk traffic, e.g. sensor updates and mesh messages */
+    UART_HAL_TX_PRIORITIES_CNT,
+};
+
+struct UartHalTxReservation
+{
+    struct RingBufferSpan  spans[RING_BUFFER_SPANS_CNT];
+    enum UartHalTxPriority priority;
+};
+
 void UartHal_Init(void);
 
 bool UartHal_IsInitialized(void);
 
 void UartHal_SendString(uint8_t *p_string);
 
+// Queue data with normal priority
 void UartHal_SendBuffer(uint8_t *p_buff, size_t buff_len);
 
 void UartHal_SendByte(uint8_t byte);
 
+/*
+ *  Reserve space in the TX DMA buffer, so data can be written there without intermediate buffers.
+ *  UartHal_TxCommit has to follow a successful reservation. Interrupts are not disabled in the meantime,
+ *  TX buffers have a single producer, so data can be queued only from the main loop.
+ *  Reserved space is continuous (the second region is always empty), so a frame is never split
+ *  between two DMA transfers. Each priority has its own buffer, DMA always sends higher priority data first.
+ *
+ *  @param len              Number of bytes to reserve
+ *  @param priority         TX priority class
+ *  @param p_reservation    [out] Reserved regions of the TX DMA buffer
+ *  @return                 True if space is reserved, false if TX DMA buffer is full
+ */
+bool UartHal_TxReserve(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation);
+
+/*
+ *  Queue data written to the reserved regions and start DMA transfer
+ *
+ *  @param p_reservation    Reservation returned by UartHal_TxReserve
+ */
+void UartHal_TxCommit(struct UartHalTxReservation *p_reservation);
+
+/*
+ *  Get free space in the TX DMA buffer
+ *
+ *  @param priority         TX priority class
+ *  @return                 The longest data which can be reserved with UartHal_TxReserve
+ */
+uint16_t UartHal_GetTxFreeSpace(enum UartHalTxPriority priority);
+
+/*
+ *  Change UART baud rate. Data queued for transmission is sent with the previous baud rate first.
+ *
+ *  @param baudrate         New baud rate
+ */
+void UartHal_SetBaudrate(uint32_t baudrate);
+
+/*
+ *  Enable TX coalescing. Queued data does not start DMA transfer immediately, it is sent by
+ *  UartHal_ProcessPendingTx, so frames queued in the meantime are sent with a single transfer.
+ *  High priority data is not held.
+ *
+ *  @param is_enable        True to enable coalescing, false to start every transfer immediately
+ *  @param window_us        Time from the first queued byte, before which pending data is not sent
+ */
+void UartHal_SetTxCoalescing(bool is_enable, uint32_t window_us);
+
+/*
+ *  Start DMA transfer of data held by TX coalescing, if the coalescing window has elapsed
+ */
+void UartHal_ProcessPendingTx(void);
+
+/*
+ *  Get number of started TX DMA transfers, each of them ends with the DMA transfer complete interrupt
+ *
+ *  @return                 Number of TX DMA transfers
+ */
+uint32_t UartHal_GetTxDmaTransfersCnt(void);
+
+uint32_t UartHal_GetBaudrate(void);
+
 bool UartHal_ReadByte(uint8_t *p_byte);
 
+/*
+ *  Check if there is received data which was not read yet
+ *
+ *  @return                 True if RX buffer is not empty
+ */
+bool UartHal_IsRxDataAvailable(void);
+
+/*
+ *  Set callback called from interrupt context when data is received. It is triggered by the idle line
+ *  detection and half/full RX DMA buffer transfer. NULL disables RX interrupts.
+ *
+ *  @param irq_cb           RX data callback
+ */
+void UartHal_SetRxDataIrq(void (*irq_cb)(void));
+
+/*
+ *  Get the longest continuous region of received and not yet consumed bytes
+ *
+ *  @param p_buf_len    [out] Number of bytes available in the returned region
+ *  @return             Pointer to the first unread byte in the RX DMA buffer
+ */
+uint8_t *UartHal_GetRxMaxContinuousBuffer(uint16_t *p_buf_len);
+
+/*
+ *  Mark bytes returned by UartHal_GetRxMaxContinuousBuffer as consumed
+ *
+ *  @param value        Number of consumed bytes
+ */
+void UartHal_IncrementRxRdIndex(uint16_t value);
+
 void UartHal_Flush(void);
 
+/*
+ *  Get RX statistics collected since initialization or the last UartHal_ClearRxStats call
+ *
+ *  @param p_stats      [out] RX statistics
+ */
+void UartHal_GetRxStats(struct UartHalRxStats *p_stats);
+
+void UartHal_ClearRxStats(void);
+
 #endif
@@ -0,0 +1,62 @@
+#include "AdcHal.h"
+
+#include "Assert.h"
+#include "Log.h"
+
+#define ADC_HAL_ADC_MID ((ADC_HAL_ADC_MAX + 1) / 2)
+
+// Measurements of the MCU internal channels at 25 degrees Celsius and 3.3V supply
+#define ADC_HAL_TEMPERATURE_100MC 2500
+#define ADC_HAL_VREFINT_RAW 1489
+
+#define VREFINT_VOLTAGE_MV 1200
+
+static bool IsInitialized = false;
+
+// There are no analog inputs on the host, sensors read constant mid-scale values
+static const uint16_t AdcResults[ADC_HAL_CHANNEL_LENGTH_MARKER] = {
+    ADC_HAL_ADC_MID,        // ADC_HAL_CHANNEL_ALS
+    ADC_HAL_ADC_MID,        // ADC_HAL_CHANNEL_POTENTIOMETER
+    ADC_HAL_ADC_MID,        // ADC_HAL_CHANNEL_RTC_BATTERY
+    ADC_HAL_ADC_MID,        // ADC_HAL_CHANNEL_TEMPERATURE_SENSOR
+    ADC_HAL_VREFINT_RAW,    // ADC_HAL_CHANNEL_UP_VCC
+};
+
+void AdcHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("AdcHal initialization");
+
+    IsInitialized = true;
+}
+
+bool AdcHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+uint16_t AdcHal_ReadChannel(enum AdcHalChannel adc_channel)
+{
+    ASSERT(adc_channel < ADC_HAL_CHANNEL_LENGTH_MARKER);
+
+    return AdcResults[adc_channel];
+}
+
+uint16_t AdcHal_ReadChannelMv(enum AdcHalChannel adc_channel, uint16_t gain_coefficient)
+{
+    ASSERT(adc_channel < ADC_HAL_CHANNEL_LENGTH_MARKER);
+
+    if (adc_channel == ADC_HAL_CHANNEL_UP_VCC)
+    {
+        // Avoid dividing by zero
+        return (VREFINT_VOLTAGE_MV * ADC_HAL_ADC_MAX) / (AdcResults[ADC_HAL_CHANNEL_UP_VCC] + 1);
+    }
+
+    return (AdcResults[adc_channel] * ADC_HAL_REF_V_MV * gain_coefficient) / ADC_HAL_ADC_MAX;
+}
+
+int32_t AdcHal_ReadTemperature100mc(void)
+{
+    return ADC_HAL_TEMPERATURE_100MC;
+}
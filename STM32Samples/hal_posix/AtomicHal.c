@@ -0,0 +1,42 @@
+#include "AtomicHal.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "AtomicHalIsr.h"
+
+// Peripheral threads hold the mutex while they run interrupt handlers, so disabling interrupts means taking the mutex
+static pthread_mutex_t IrqMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static __thread bool IsIrqDisabled = false;
+static __thread bool IsIsrContext  = false;
+
+void AtomicHal_IrqEnable(void)
+{
+    if (IsIrqDisabled && !IsIsrContext)
+    {
+        IsIrqDisabled = false;
+        pthread_mutex_unlock(&IrqMutex);
+    }
+}
+
+void AtomicHal_IrqDisable(void)
+{
+    if (!IsIrqDisabled && !IsIsrContext)
+    {
+        pthread_mutex_lock(&IrqMutex);
+        IsIrqDisabled = true;
+    }
+}
+
+void AtomicHal_IsrEnter(void)
+{
+    pthread_mutex_lock(&IrqMutex);
+    IsIsrContext = true;
+}
+
+void AtomicHal_IsrExit(void)
+{
+    IsIsrContext = false;
+    pthread_mutex_unlock(&IrqMutex);
+}
@@ -0,0 +1,13 @@
+#ifndef ATOMIC_HAL_ISR_H
+#define ATOMIC_HAL_ISR_H
+
+/*
+ *  Run the calling thread as an interrupt handler until AtomicHal_IsrExit. The handler does not run
+ *  while the main thread is in a critical section, and critical sections inside the handler do not
+ *  release the main thread.
+ */
+void AtomicHal_IsrEnter(void);
+
+void AtomicHal_IsrExit(void);
+
+#endif
@@ -0,0 +1,33 @@
+#include "EncoderHal.h"
+
+#include "Assert.h"
+#include "Log.h"
+
+static bool    IsInitialized = false;
+static int32_t Position      = 0;
+
+void EncoderHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("EncoderHal initialization");
+
+    IsInitialized = true;
+}
+
+bool EncoderHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+int32_t EncoderHal_GetPosition(void)
+{
+    return Position;
+}
+
+void EncoderHal_SetPosition(int32_t position)
+{
+    ASSERT((position <= ENCODER_HAL_MAX_VALUE) && (position >= ENCODER_HAL_MIN_VALUE));
+
+    Position = position;
+}
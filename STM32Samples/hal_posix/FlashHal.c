@@ -0,0 +1,106 @@
+#include "FlashHal.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "Assert.h"
+#include "Log.h"
+#include "Utils.h"
+
+// Emulated flash is mapped at the MCU flash address, so 32-bit flash addresses used by the application stay valid
+#define FLASH_HAL_FLASH_START_ADDRESS 0x08000000
+#define FLASH_HAL_FLASH_SIZE (128 * 1024)
+#define FLASH_HAL_FLASH_END_ADDRESS (FLASH_HAL_FLASH_START_ADDRESS + FLASH_HAL_FLASH_SIZE)
+
+// There is no firmware image in the emulated flash, the first half is reserved for it like on the MCU
+#define FLASH_HAL_SPACE_ADDRESS (FLASH_HAL_FLASH_START_ADDRESS + FLASH_HAL_FLASH_SIZE / 2)
+
+#define FLASH_HAL_WORD_SIZE 4
+#define FLASH_HAL_BLANK_WORD 0xFFFFFFFF
+#define FLASH_HAL_BLANK_BYTE 0xFF
+
+static bool IsInitialized = false;
+
+void FlashHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("FlashHal initialization");
+
+    void *p_flash = mmap((void *)FLASH_HAL_FLASH_START_ADDRESS,
+                         FLASH_HAL_FLASH_SIZE,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                         -1,
+                         0);
+    ASSERT(p_flash == (void *)FLASH_HAL_FLASH_START_ADDRESS);
+
+    memset(p_flash, FLASH_HAL_BLANK_BYTE, FLASH_HAL_FLASH_SIZE);
+
+    IsInitialized = true;
+}
+
+bool FlashHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+size_t FlashHal_GetSpaceSize(void)
+{
+    return FLASH_HAL_FLASH_END_ADDRESS - FlashHal_GetSpaceAddress();
+}
+
+uint32_t FlashHal_GetSpaceAddress(void)
+{
+    return FLASH_HAL_SPACE_ADDRESS;
+}
+
+bool FlashHal_EraseSpace(void)
+{
+    ASSERT(IsInitialized);
+
+    memset((void *)(uintptr_t)FlashHal_GetSpaceAddress(), FLASH_HAL_BLANK_BYTE, FlashHal_GetSpaceSize());
+
+    return true;
+}
+
+bool FlashHal_EraseSpacePage(void)
+{
+    // Emulated flash is erased at once
+    return FlashHal_EraseSpace();
+}
+
+bool FlashHal_SaveToFlash(uint32_t address, const uint32_t *p_src, uint32_t num_of_words)
+{
+    ASSERT((address >= FLASH_HAL_FLASH_START_ADDRESS) && (address < FLASH_HAL_FLASH_END_ADDRESS) && (p_src != NULL));
+
+    uint32_t flash_end_addr = address + num_of_words * FLASH_HAL_WORD_SIZE;
+
+    ASSERT((flash_end_addr >= FLASH_HAL_FLASH_START_ADDRESS) && (flash_end_addr <= FLASH_HAL_FLASH_END_ADDRESS));
+
+    while (address < flash_end_addr)
+    {
+        uint32_t *p_dst = (uint32_t *)(uintptr_t)address;
+
+        // Programming a word which is not erased fails on the MCU
+        ASSERT(*p_dst == FLASH_HAL_BLANK_WORD);
+
+        *p_dst = *p_src;
+
+        address += FLASH_HAL_WORD_SIZE;
+        p_src++;
+    }
+
+    return true;
+}
+
+bool FlashHal_UpdateFirmware(uint32_t num_of_words)
+{
+    // The host executable cannot be replaced, the process exits instead of the reset to the new firmware
+    LOG_D("Firmware update, %u words received, exiting", (unsigned int)num_of_words);
+    LOG_FLUSH();
+
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,70 @@
+#include "GpioHal.h"
+
+#include <stddef.h>
+
+#include "Assert.h"
+#include "Log.h"
+
+struct GpioHalPinState
+{
+    enum GpioHalGpioMode mode;
+    bool                 is_high;
+    void (*irq_cb)(void);
+};
+
+static bool IsInitialized = false;
+
+static struct GpioHalPinState PinStates[GPIO_HAL_PIN_LENGTH_MARKER];
+
+void GpioHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("GpioHal initialization");
+
+    IsInitialized = true;
+}
+
+bool GpioHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+void GpioHal_PinMode(enum GpioHalPin gpio, enum GpioHalGpioMode mode)
+{
+    ASSERT((gpio < GPIO_HAL_PIN_LENGTH_MARKER) && (mode < GPIO_HAL_MODE_LENGTH_MARKER));
+
+    PinStates[gpio].mode = mode;
+
+    // Nothing is connected to the pins, so inputs with pull-up read high, e.g. buttons are released
+    PinStates[gpio].is_high = (mode == GPIO_HAL_MODE_INPUT_PULLUP);
+}
+
+void GpioHal_SetPinIrq(enum GpioHalPin gpio, enum GpioHalGpioIrqEdge edge, void (*irq_cb)(void))
+{
+    ASSERT((gpio < GPIO_HAL_PIN_LENGTH_MARKER) && (edge < GPIO_HAL_IRQ_EDGE_LENGTH_MARKER));
+
+    // Input levels never change, so the callback is never called
+    PinStates[gpio].irq_cb = irq_cb;
+}
+
+bool GpioHal_PinRead(enum GpioHalPin gpio)
+{
+    ASSERT(gpio < GPIO_HAL_PIN_LENGTH_MARKER);
+
+    return PinStates[gpio].is_high;
+}
+
+void GpioHal_PinSet(enum GpioHalPin gpio, bool high)
+{
+    ASSERT((gpio < GPIO_HAL_PIN_LENGTH_MARKER) && (PinStates[gpio].mode == GPIO_HAL_MODE_OUTPUT));
+
+    PinStates[gpio].is_high = high;
+}
+
+void GpioHal_PinToggle(enum GpioHalPin gpio)
+{
+    ASSERT((gpio < GPIO_HAL_PIN_LENGTH_MARKER) && (PinStates[gpio].mode == GPIO_HAL_MODE_OUTPUT));
+
+    PinStates[gpio].is_high = !PinStates[gpio].is_high;
+}
@@ -0,0 +1,35 @@
+#include "I2cHal.h"
+
+#include "Assert.h"
+#include "Log.h"
+
+static bool IsInitialized = false;
+
+void I2cHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("I2cHal initialization");
+
+    IsInitialized = true;
+}
+
+bool I2cHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+bool I2cHal_ProcessTransaction(struct I2cTransaction *p_transaction)
+{
+    ASSERT(p_transaction != NULL);
+
+    // There are no devices on the host I2C bus
+    return false;
+}
+
+bool I2cHal_IsAvaliable(uint8_t address)
+{
+    UNUSED(address);
+
+    return false;
+}
@@ -0,0 +1,54 @@
+#include "LoggerHal.h"
+
+#include <string.h>
+
+#include "Assert.h"
+
+static bool IsInitialized = false;
+
+void LoggerHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    // Logs are written to stdout line by line, so they interleave correctly with other processes output
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    IsInitialized = true;
+}
+
+bool LoggerHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+void LoggerHal_SendString(uint8_t *p_string)
+{
+    ASSERT(p_string != NULL);
+
+    LoggerHal_SendBuffer(p_string, strlen((char *)p_string));
+}
+
+void LoggerHal_SendBuffer(uint8_t *p_buff, size_t buff_len)
+{
+    ASSERT(p_buff != NULL);
+
+    fwrite(p_buff, 1, buff_len, stdout);
+}
+
+void LoggerHal_SendByte(uint8_t byte)
+{
+    LoggerHal_SendBuffer(&byte, 1);
+}
+
+bool LoggerHal_ReadByte(uint8_t *p_byte)
+{
+    ASSERT(p_byte != NULL);
+
+    // Logger console input is not supported on the host
+    return false;
+}
+
+void LoggerHal_Flush(void)
+{
+    fflush(stdout);
+}
@@ -0,0 +1,42 @@
+#include "NewlibCompat.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Assert.h"
+
+char *itoa(int value, char *p_str, int base)
+{
+    ASSERT((p_str != NULL) && (base >= 2) && (base <= 36));
+
+    bool         is_negative = (value < 0) && (base == 10);
+    unsigned int uvalue      = is_negative ? -(unsigned int)value : (unsigned int)value;
+    char        *p_digit     = p_str;
+
+    if (is_negative)
+    {
+        *p_digit++ = '-';
+    }
+
+    char *p_first_digit = p_digit;
+
+    do
+    {
+        unsigned int digit = uvalue % base;
+        *p_digit++         = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
+        uvalue /= base;
+    } while (uvalue != 0);
+
+    *p_digit = '\0';
+
+    // Digits are generated from the least significant one
+    p_digit--;
+    while (p_first_digit < p_digit)
+    {
+        char tmp         = *p_first_digit;
+        *p_first_digit++ = *p_digit;
+        *p_digit--       = tmp;
+    }
+
+    return p_str;
+}
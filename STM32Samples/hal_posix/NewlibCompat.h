@@ -0,0 +1,19 @@
+#ifndef NEWLIB_COMPAT_H
+#define NEWLIB_COMPAT_H
+
+/*
+ *  Newlib extensions used by the application which are missing in glibc. The header is included
+ *  in every host source file with the -include compiler option.
+ */
+
+/*
+ *  Convert integer to string
+ *
+ *  @param value        Value to convert
+ *  @param p_str        Output buffer, long enough for the value with the sign and terminating null
+ *  @param base         Numerical base, 2 - 36
+ *  @return             p_str
+ */
+char *itoa(int value, char *p_str, int base);
+
+#endif
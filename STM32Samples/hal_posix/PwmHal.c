@@ -0,0 +1,28 @@
+#include "PwmHal.h"
+
+#include "Assert.h"
+#include "Log.h"
+
+static bool     IsInitialized = false;
+static uint16_t DutyCycles[PWM_HAL_CHANNEL_LENGTH_MARKER];
+
+void PwmHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("PwmHal initialization");
+
+    IsInitialized = true;
+}
+
+bool PwmHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+void PwmHal_SetPwmDuty(enum PwmHalChannel channel, uint16_t duty_cycle)
+{
+    ASSERT((channel < PWM_HAL_CHANNEL_LENGTH_MARKER) && (duty_cycle <= PWM_HAL_OUTPUT_DUTY_CYCLE_MAX));
+
+    DutyCycles[channel] = duty_cycle;
+}
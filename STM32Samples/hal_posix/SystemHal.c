@@ -0,0 +1,47 @@
+#include "SystemHal.h"
+
+#include <unistd.h>
+
+#include "Assert.h"
+#include "Config.h"
+#include "Log.h"
+
+static bool IsInitialized = false;
+
+void SystemHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    IsInitialized = true;
+}
+
+bool SystemHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+uint32_t SystemHal_GetCoreClock(void)
+{
+    // Emulated clock, timings derived from it match the MCU
+    return SYSTEM_HAL_CLOCK_HZ;
+}
+
+void SystemHal_PrintResetCause(void)
+{
+    LOG_D("Reset cause: POSIX host process start");
+}
+
+void SystemHal_PrintBuildInfo(void)
+{
+    LOG_D("Build date: %s", __DATE__);
+    LOG_D("Build time: %s", __TIME__);
+
+    uint8_t *p_fw_version = (uint8_t *)BUILD_NUMBER;
+#if MCU_SERVER == 1
+    LOG_D("MCU SERVER FW version %s", p_fw_version);
+#elif MCU_CLIENT == 1
+    LOG_D("MCU CLIENT FW version %s", p_fw_version);
+#endif
+
+    LOG_D("POSIX host PID: %d", (int)getpid());
+}
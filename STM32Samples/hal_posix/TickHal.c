@@ -0,0 +1,49 @@
+#include "TickHal.h"
+
+#include <time.h>
+
+#include "Assert.h"
+#include "SystemHal.h"
+
+#define TICK_HAL_NS_IN_US 1000
+#define TICK_HAL_NS_IN_MS 1000000
+#define TICK_HAL_US_IN_SECOND 1000000
+#define TICK_HAL_NS_IN_SECOND 1000000000
+
+static bool            IsInitialized = false;
+static struct timespec StartTime;
+
+static uint64_t TickHal_GetElapsedNs(void);
+
+void TickHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    clock_gettime(CLOCK_MONOTONIC, &StartTime);
+
+    IsInitialized = true;
+}
+
+bool TickHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+uint32_t TickHal_GetTimestampMs(void)
+{
+    return (uint32_t)(TickHal_GetElapsedNs() / TICK_HAL_NS_IN_MS);
+}
+
+uint32_t TickHal_GetClockTick(void)
+{
+    // Ticks of the emulated core clock, the same as the cycle counter on the MCU
+    return (uint32_t)(TickHal_GetElapsedNs() * (SystemHal_GetCoreClock() / TICK_HAL_US_IN_SECOND) / TICK_HAL_NS_IN_US);
+}
+
+static uint64_t TickHal_GetElapsedNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)(now.tv_sec - StartTime.tv_sec) * TICK_HAL_NS_IN_SECOND + (uint64_t)now.tv_nsec - (uint64_t)StartTime.tv_nsec;
+}
@@ -0,0 +1,757 @@
+#include "UartHal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Assert.h"
+#include "Atomic.h"
+#include "AtomicHalIsr.h"
+#include "Log.h"
+#include "RingBuffer.h"
+#include "SystemHal.h"
+#include "TickHal.h"
+
+#define UART_HAL_RX_BUFFER_LEN 512
+#define UART_HAL_RX_BUFFER_HALF_LEN (UART_HAL_RX_BUFFER_LEN / 2)
+#define UART_HAL_TX_BUFFER_LEN 1024
+#define UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN 256
+
+// Coalesced data is sent immediately when it fills this part of the TX buffer
+#define UART_HAL_TX_COALESCING_THRESHOLD (UART_HAL_TX_BUFFER_LEN / 2)
+
+#define UART_HAL_US_IN_SECOND 1000000
+#define UART_HAL_NS_IN_SECOND 1000000000
+
+// Start bit, 8 data bits and stop bit
+#define UART_HAL_BITS_PER_BYTE 10
+
+#define UART_HAL_ENV_FD "UART_HAL_FD"               /**< Use this inherited descriptor, e.g. socketpair end, instead of a pty */
+#define UART_HAL_ENV_PTY_LINK "UART_HAL_PTY_LINK"   /**< Create a symbolic link to the pty at this path */
+#define UART_HAL_ENV_PACING "UART_HAL_PACING"       /**< Set to 0 to transfer data without the baud rate delays */
+
+static bool IsInitialized = false;
+
+static uint32_t Baudrate = UART_HAL_DEFAULT_BAUDRATE;
+
+static int  UartFd          = -1;
+static int  PtySlaveFd      = -1;
+static bool IsPacingEnabled = true;
+
+static pthread_t RxThread;
+static pthread_t TxThread;
+
+static volatile uint8_t DmaTxBuffer[UART_HAL_TX_BUFFER_LEN];
+static volatile uint8_t DmaTxHighPriorityBuffer[UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN];
+static volatile uint8_t DmaRxBuffer[UART_HAL_RX_BUFFER_LEN];
+
+// Indexed with enum UartHalTxPriority, the first non-empty buffer is sent. Data is queued only from the main thread
+// and read by the TX thread, so buffers are accessed without critical section.
+static struct RingBuffer TxDmaBuffers[UART_HAL_TX_PRIORITIES_CNT];
+
+// Buffer of the ongoing DMA transfer
+static struct RingBuffer *CurrentTxDmaBuffer = NULL;
+
+// Emulated TX DMA channel, the TX thread writes the transfer to the descriptor and raises the transfer complete flag
+static pthread_mutex_t TxDmaMutex      = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  TxDmaCond       = PTHREAD_COND_INITIALIZER;
+static uint8_t        *TxDmaMemory     = NULL;
+static uint16_t        TxDmaLen        = 0;
+static bool            IsTxDmaEnabled  = false;
+static bool            IsTxDmaComplete = false;
+
+static uint32_t DmaRxReadPtr = 0;
+
+// Written only by the RX thread, the same as the DMA write position on the MCU
+static uint32_t DmaRxWrittenCnt = 0;
+
+static uint32_t DmaRxReadCnt     = 0;
+static uint32_t RxBytesCntOffset = 0;
+static uint32_t RxOverrunsCnt    = 0;
+static uint16_t RxHighWaterMark  = 0;
+
+static volatile uint16_t CurrentTxTransferLen = 0;
+static volatile bool     isFlushInProgress    = false;
+
+static bool     IsTxCoalescingEnabled   = false;
+static bool     IsTxPending             = false;
+static uint32_t TxCoalescingWindowTicks = 0;
+static uint32_t TxPendingStartTick      = 0;
+static uint32_t TxDmaTransfersCnt       = 0;
+
+static void (*RxDataIrqCb)(void) = NULL;
+
+static void  UartHal_InitFd(void);
+static void  UartHal_InitPty(void);
+static void  UartHal_InitThreads(void);
+static void *UartHal_RxThread(void *p_arg);
+static void *UartHal_TxThread(void *p_arg);
+static void  UartHal_Transmit(const uint8_t *p_data, size_t len);
+static void  UartHal_WaitLineTime(size_t len);
+
+static void     UartHal_DmaStartNextTxTransfer(void);
+static void     UartHal_TxStart(enum UartHalTxPriority priority);
+static void     UartHal_TxDmaEnable(uint8_t *p_data, uint16_t len);
+static void     UartHal_TxDmaDisable(void);
+static void     UartHal_TxDmaIrqHandler(void);
+static uint32_t UartHal_GetRxWrittenCnt(uint32_t *p_dma_write_ptr);
+static void     UartHal_UpdateRxStats(void);
+static void     UartHal_RxDataIrqNotify(void);
+
+static struct RingBuffer *UartHal_GetNextTxDmaBuffer(void);
+
+void UartHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("UartHal initialization");
+
+    RingBuffer_Init(&TxDmaBuffers[UART_HAL_TX_PRIORITY_HIGH], DmaTxHighPriorityBuffer, UART_HAL_TX_HIGH_PRIORITY_BUFFER_LEN);
+    RingBuffer_Init(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], DmaTxBuffer, UART_HAL_TX_BUFFER_LEN);
+
+    UartHal_InitFd();
+    UartHal_InitThreads();
+
+    IsInitialized = true;
+}
+
+bool UartHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+void UartHal_SendString(uint8_t *p_string)
+{
+    ASSERT(p_string != NULL);
+
+    UartHal_SendBuffer(p_string, strlen((char *)p_string));
+}
+
+void UartHal_SendBuffer(uint8_t *p_buff, size_t buff_len)
+{
+    ASSERT(p_buff != NULL);
+
+    struct RingBufferSpan span;
+
+    // Buffer is queued as a continuous record, so it is never split between DMA transfers
+    if (!RingBuffer_ReserveContinuous(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], buff_len, &span))
+    {
+        ASSERT(false);
+    }
+    else
+    {
+        memcpy(span.p_buf, p_buff, buff_len);
+        RingBuffer_CommitContinuous(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL], &span);
+    }
+
+    Atomic_CriticalEnter();
+
+    UartHal_TxStart(UART_HAL_TX_PRIORITY_NORMAL);
+
+    Atomic_CriticalExit();
+}
+
+void UartHal_SendByte(uint8_t byte)
+{
+    UartHal_SendBuffer(&byte, 1);
+}
+
+bool UartHal_TxReserve(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation)
+{
+    ASSERT((p_reservation != NULL) && (priority < UART_HAL_TX_PRIORITIES_CNT));
+
+    p_reservation->priority = priority;
+
+    if (!RingBuffer_ReserveContinuous(&TxDmaBuffers[priority], len, &p_reservation->spans[0]))
+    {
+        return false;
+    }
+
+    p_reservation->spans[1].p_buf = p_reservation->spans[0].p_buf;
+    p_reservation->spans[1].len   = 0;
+
+    return true;
+}
+
+void UartHal_TxCommit(struct UartHalTxReservation *p_reservation)
+{
+    ASSERT(p_reservation != NULL);
+
+    RingBuffer_CommitContinuous(&TxDmaBuffers[p_reservation->priority], &p_reservation->spans[0]);
+
+    Atomic_CriticalEnter();
+
+    UartHal_TxStart(p_reservation->priority);
+
+    Atomic_CriticalExit();
+}
+
+uint16_t UartHal_GetTxFreeSpace(enum UartHalTxPriority priority)
+{
+    ASSERT(priority < UART_HAL_TX_PRIORITIES_CNT);
+
+    return RingBuffer_GetMaxContinuousFreeLen(&TxDmaBuffers[priority]);
+}
+
+void UartHal_SetTxCoalescing(bool is_enable, uint32_t window_us)
+{
+    Atomic_CriticalEnter();
+
+    IsTxCoalescingEnabled   = is_enable;
+    TxCoalescingWindowTicks = (SystemHal_GetCoreClock() / UART_HAL_US_IN_SECOND) * window_us;
+
+    if (!is_enable && IsTxPending && !IsTxDmaEnabled)
+    {
+        UartHal_DmaStartNextTxTransfer();
+    }
+
+    Atomic_CriticalExit();
+}
+
+void UartHal_ProcessPendingTx(void)
+{
+    Atomic_CriticalEnter();
+
+    if (IsTxPending && !IsTxDmaEnabled && ((TickHal_GetClockTick() - TxPendingStartTick) >= TxCoalescingWindowTicks))
+    {
+        UartHal_DmaStartNextTxTransfer();
+    }
+
+    Atomic_CriticalExit();
+}
+
+uint32_t UartHal_GetTxDmaTransfersCnt(void)
+{
+    return TxDmaTransfersCnt;
+}
+
+void UartHal_SetBaudrate(uint32_t baudrate)
+{
+    ASSERT(IsInitialized && (baudrate != 0));
+
+    // Data queued with the previous baud rate has to be sent before the change
+    UartHal_Flush();
+
+    Baudrate = baudrate;
+
+    if (PtySlaveFd >= 0)
+    {
+        // Line speed has no effect on a pty, it is only reported to the peer
+        struct termios tio;
+        tcgetattr(PtySlaveFd, &tio);
+        cfsetspeed(&tio, baudrate);
+        tcsetattr(PtySlaveFd, TCSANOW, &tio);
+    }
+
+    LOG_D("UartHal baud rate: %u", (unsigned int)baudrate);
+}
+
+uint32_t UartHal_GetBaudrate(void)
+{
+    return Baudrate;
+}
+
+bool UartHal_ReadByte(uint8_t *p_byte)
+{
+    ASSERT(p_byte != NULL);
+
+    UartHal_UpdateRxStats();
+
+    uint32_t dma_write_ptr;
+    UartHal_GetRxWrittenCnt(&dma_write_ptr);
+
+    if (dma_write_ptr != DmaRxReadPtr)
+    {
+        *p_byte = DmaRxBuffer[DmaRxReadPtr];
+        DmaRxReadPtr++;
+        DmaRxReadCnt++;
+        if (DmaRxReadPtr == UART_HAL_RX_BUFFER_LEN)
+        {
+            DmaRxReadPtr = 0;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool UartHal_IsRxDataAvailable(void)
+{
+    uint32_t dma_write_ptr;
+    UartHal_GetRxWrittenCnt(&dma_write_ptr);
+
+    return dma_write_ptr != DmaRxReadPtr;
+}
+
+void UartHal_SetRxDataIrq(void (*irq_cb)(void))
+{
+    Atomic_CriticalEnter();
+
+    // Every read completed by the RX thread is signaled, it corresponds to the idle line interrupt
+    RxDataIrqCb = irq_cb;
+
+    Atomic_CriticalExit();
+}
+
+void UartHal_GetRxStats(struct UartHalRxStats *p_stats)
+{
+    ASSERT(p_stats != NULL);
+
+    UartHal_UpdateRxStats();
+
+    uint32_t dma_write_ptr;
+
+    p_stats->bytes_cnt       = UartHal_GetRxWrittenCnt(&dma_write_ptr) - RxBytesCntOffset;
+    p_stats->overruns_cnt    = RxOverrunsCnt;
+    p_stats->high_water_mark = RxHighWaterMark;
+    p_stats->buffer_len      = UART_HAL_RX_BUFFER_LEN;
+}
+
+void UartHal_ClearRxStats(void)
+{
+    uint32_t dma_write_ptr;
+
+    RxBytesCntOffset = UartHal_GetRxWrittenCnt(&dma_write_ptr);
+    RxOverrunsCnt    = 0;
+    RxHighWaterMark  = 0;
+}
+
+uint8_t *UartHal_GetRxMaxContinuousBuffer(uint16_t *p_buf_len)
+{
+    ASSERT(p_buf_len != NULL);
+
+    UartHal_UpdateRxStats();
+
+    uint32_t dma_write_ptr;
+    UartHal_GetRxWrittenCnt(&dma_write_ptr);
+
+    if (dma_write_ptr >= DmaRxReadPtr)
+    {
+        *p_buf_len = dma_write_ptr - DmaRxReadPtr;
+    }
+    else
+    {
+        // DMA write pointer has wrapped around, return data up to the end of the buffer
+        *p_buf_len = UART_HAL_RX_BUFFER_LEN - DmaRxReadPtr;
+    }
+
+    return &DmaRxBuffer[DmaRxReadPtr];
+}
+
+void UartHal_IncrementRxRdIndex(uint16_t value)
+{
+    ASSERT(value <= UART_HAL_RX_BUFFER_LEN);
+
+    DmaRxReadPtr += value;
+    DmaRxReadCnt += value;
+    if (DmaRxReadPtr >= UART_HAL_RX_BUFFER_LEN)
+    {
+        DmaRxReadPtr -= UART_HAL_RX_BUFFER_LEN;
+    }
+}
+
+void UartHal_Flush(void)
+{
+    // The TX thread does not complete the transfer during the flush and no new transfer is started
+    Atomic_CriticalEnter();
+    isFlushInProgress = true;
+    Atomic_CriticalExit();
+
+    if (IsTxDmaEnabled)
+    {
+        pthread_mutex_lock(&TxDmaMutex);
+        while (!IsTxDmaComplete)
+        {
+            // Wait until DMA transfer complete
+            pthread_cond_wait(&TxDmaCond, &TxDmaMutex);
+        }
+        pthread_mutex_unlock(&TxDmaMutex);
+
+        Atomic_CriticalEnter();
+
+        RingBuffer_IncrementRdIndex(CurrentTxDmaBuffer, CurrentTxTransferLen);
+        CurrentTxTransferLen = 0;
+
+        UartHal_TxDmaDisable();
+
+        Atomic_CriticalExit();
+    }
+
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+    size_t                priority;
+    size_t                i;
+    for (priority = UART_HAL_TX_PRIORITY_HIGH; priority < UART_HAL_TX_PRIORITIES_CNT; priority++)
+    {
+        // Lower priority buffer is sent after the higher one is empty
+        uint16_t tx_len = RingBuffer_GetReadSpans(&TxDmaBuffers[priority], spans);
+
+        for (i = 0; i < RING_BUFFER_SPANS_CNT; i++)
+        {
+            UartHal_Transmit(spans[i].p_buf, spans[i].len);
+        }
+
+        RingBuffer_IncrementRdIndex(&TxDmaBuffers[priority], tx_len);
+    }
+
+    Atomic_CriticalEnter();
+    isFlushInProgress = false;
+    IsTxPending       = false;
+    Atomic_CriticalExit();
+}
+
+static void UartHal_InitFd(void)
+{
+    // Writing to a closed socket has to fail instead of terminating the process
+    signal(SIGPIPE, SIG_IGN);
+
+    char *p_pacing = getenv(UART_HAL_ENV_PACING);
+    IsPacingEnabled = (p_pacing == NULL) || (strcmp(p_pacing, "0") != 0);
+
+    char *p_fd = getenv(UART_HAL_ENV_FD);
+    if (p_fd == NULL)
+    {
+        UartHal_InitPty();
+        return;
+    }
+
+    UartFd = atoi(p_fd);
+
+    int flags = fcntl(UartFd, F_GETFL);
+    ASSERT(flags != -1);
+
+    // RX and TX threads wait for the descriptor with poll, so blocking mode is not required
+    LOG_D("UartHal fd: %d, pacing: %u", UartFd, IsPacingEnabled);
+}
+
+static void UartHal_InitPty(void)
+{
+    UartFd = posix_openpt(O_RDWR | O_NOCTTY);
+    ASSERT(UartFd >= 0);
+
+    int status = grantpt(UartFd);
+    ASSERT(status == 0);
+
+    status = unlockpt(UartFd);
+    ASSERT(status == 0);
+
+    char *p_pty_name = ptsname(UartFd);
+    ASSERT(p_pty_name != NULL);
+
+    // Slave side is kept open, so its settings persist and the master does not report hang up between peers
+    PtySlaveFd = open(p_pty_name, O_RDWR | O_NOCTTY);
+    ASSERT(PtySlaveFd >= 0);
+
+    struct termios tio;
+    tcgetattr(PtySlaveFd, &tio);
+    cfmakeraw(&tio);
+    cfsetspeed(&tio, Baudrate);
+    tcsetattr(PtySlaveFd, TCSANOW, &tio);
+
+    char *p_pty_link = getenv(UART_HAL_ENV_PTY_LINK);
+    if (p_pty_link != NULL)
+    {
+        unlink(p_pty_link);
+        status = symlink(p_pty_name, p_pty_link);
+        ASSERT(status == 0);
+    }
+
+    LOG_D("UartHal pty: %s, pacing: %u", p_pty_name, IsPacingEnabled);
+}
+
+static void UartHal_InitThreads(void)
+{
+    int status = pthread_create(&RxThread, NULL, UartHal_RxThread, NULL);
+    ASSERT(status == 0);
+
+    status = pthread_create(&TxThread, NULL, UartHal_TxThread, NULL);
+    ASSERT(status == 0);
+}
+
+static void *UartHal_RxThread(void *p_arg)
+{
+    UNUSED(p_arg);
+
+    struct pollfd poll_fd = {
+        .fd     = UartFd,
+        .events = POLLIN,
+    };
+
+    while (true)
+    {
+        uint32_t dma_write_ptr = DmaRxWrittenCnt % UART_HAL_RX_BUFFER_LEN;
+
+        // Data is read up to the next half of the buffer, the same as DMA half and full transfer interrupts
+        ssize_t rx_len = read(UartFd, (uint8_t *)&DmaRxBuffer[dma_write_ptr], UART_HAL_RX_BUFFER_HALF_LEN - (dma_write_ptr % UART_HAL_RX_BUFFER_HALF_LEN));
+
+        if (rx_len == 0)
+        {
+            LOG_W("UartHal peer closed the connection");
+            LOG_FLUSH();
+            exit(EXIT_SUCCESS);
+        }
+
+        if (rx_len < 0)
+        {
+            ASSERT((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+            poll(&poll_fd, 1, -1);
+            continue;
+        }
+
+        // Data is available after the time the bytes take on the UART line
+        UartHal_WaitLineTime(rx_len);
+
+        AtomicHal_IsrEnter();
+
+        // Unread data is overwritten when the application does not keep up, like on the MCU
+        __atomic_store_n(&DmaRxWrittenCnt, DmaRxWrittenCnt + (uint32_t)rx_len, __ATOMIC_RELEASE);
+        UartHal_RxDataIrqNotify();
+
+        AtomicHal_IsrExit();
+    }
+
+    return NULL;
+}
+
+static void *UartHal_TxThread(void *p_arg)
+{
+    UNUSED(p_arg);
+
+    while (true)
+    {
+        pthread_mutex_lock(&TxDmaMutex);
+        while (!IsTxDmaEnabled || IsTxDmaComplete)
+        {
+            pthread_cond_wait(&TxDmaCond, &TxDmaMutex);
+        }
+
+        uint8_t *p_tx_data = TxDmaMemory;
+        uint16_t tx_len    = TxDmaLen;
+        pthread_mutex_unlock(&TxDmaMutex);
+
+        UartHal_Transmit(p_tx_data, tx_len);
+
+        pthread_mutex_lock(&TxDmaMutex);
+        IsTxDmaComplete = true;
+        pthread_cond_broadcast(&TxDmaCond);
+        pthread_mutex_unlock(&TxDmaMutex);
+
+        AtomicHal_IsrEnter();
+        UartHal_TxDmaIrqHandler();
+        AtomicHal_IsrExit();
+    }
+
+    return NULL;
+}
+
+static void UartHal_Transmit(const uint8_t *p_data, size_t len)
+{
+    // The peer receives data after the time the bytes take on the UART line
+    UartHal_WaitLineTime(len);
+
+    struct pollfd poll_fd = {
+        .fd     = UartFd,
+        .events = POLLOUT,
+    };
+
+    size_t written_len = 0;
+    while (written_len < len)
+    {
+        ssize_t status = write(UartFd, p_data + written_len, len - written_len);
+        if (status >= 0)
+        {
+            written_len += status;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            // Peer does not keep up, wait instead of dropping data, so the application sees the back pressure
+            poll(&poll_fd, 1, -1);
+        }
+        else if (errno != EINTR)
+        {
+            // Data sent to a disconnected peer is lost, the same as on a UART line
+            break;
+        }
+    }
+}
+
+static void UartHal_WaitLineTime(size_t len)
+{
+    if (!IsPacingEnabled)
+    {
+        return;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    uint64_t transfer_ns = (uint64_t)len * UART_HAL_BITS_PER_BYTE * UART_HAL_NS_IN_SECOND / Baudrate;
+
+    deadline.tv_sec += transfer_ns / UART_HAL_NS_IN_SECOND;
+    deadline.tv_nsec += transfer_ns % UART_HAL_NS_IN_SECOND;
+    if (deadline.tv_nsec >= UART_HAL_NS_IN_SECOND)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= UART_HAL_NS_IN_SECOND;
+    }
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+        // Sleep again after a signal
+    }
+}
+
+static void UartHal_TxStart(enum UartHalTxPriority priority)
+{
+    if (IsTxDmaEnabled)
+    {
+        // Queued data is sent after the current transfer, together with data queued in the meantime
+        return;
+    }
+
+    if (IsTxCoalescingEnabled && (priority != UART_HAL_TX_PRIORITY_HIGH) &&
+        (RingBuffer_DataLen(&TxDmaBuffers[UART_HAL_TX_PRIORITY_NORMAL]) < UART_HAL_TX_COALESCING_THRESHOLD))
+    {
+        // Transfer is started by UartHal_ProcessPendingTx, so more data can be sent with a single DMA transfer
+        if (!IsTxPending)
+        {
+            IsTxPending        = true;
+            TxPendingStartTick = TickHal_GetClockTick();
+        }
+        return;
+    }
+
+    UartHal_DmaStartNextTxTransfer();
+}
+
+static void UartHal_DmaStartNextTxTransfer(void)
+{
+    if (isFlushInProgress)
+    {
+        return;
+    }
+
+    IsTxPending = false;
+
+    struct RingBuffer *p_tx_dma_buffer = UartHal_GetNextTxDmaBuffer();
+    if (p_tx_dma_buffer == NULL)
+    {
+        return;
+    }
+
+    CurrentTxDmaBuffer          = p_tx_dma_buffer;
+    uint8_t *p_tx_begin_pointer = RingBuffer_GetMaxContinuousBuffer(CurrentTxDmaBuffer, &CurrentTxTransferLen);
+    if (CurrentTxTransferLen == 0)
+    {
+        return;
+    }
+
+    TxDmaTransfersCnt++;
+
+    UartHal_TxDmaEnable(p_tx_begin_pointer, CurrentTxTransferLen);
+}
+
+static void UartHal_TxDmaEnable(uint8_t *p_data, uint16_t len)
+{
+    pthread_mutex_lock(&TxDmaMutex);
+
+    TxDmaMemory     = p_data;
+    TxDmaLen        = len;
+    IsTxDmaComplete = false;
+    IsTxDmaEnabled  = true;
+
+    pthread_cond_broadcast(&TxDmaCond);
+    pthread_mutex_unlock(&TxDmaMutex);
+}
+
+static void UartHal_TxDmaDisable(void)
+{
+    pthread_mutex_lock(&TxDmaMutex);
+
+    IsTxDmaEnabled  = false;
+    IsTxDmaComplete = false;
+
+    pthread_mutex_unlock(&TxDmaMutex);
+}
+
+static void UartHal_TxDmaIrqHandler(void)
+{
+    pthread_mutex_lock(&TxDmaMutex);
+    bool is_transfer_complete = IsTxDmaEnabled && IsTxDmaComplete;
+    pthread_mutex_unlock(&TxDmaMutex);
+
+    // Transfer completed during the flush is finished by UartHal_Flush
+    if (isFlushInProgress || !is_transfer_complete)
+    {
+        return;
+    }
+
+    // Transfer is started from the main thread only within critical section, which the interrupt context holds
+    RingBuffer_IncrementRdIndex(CurrentTxDmaBuffer, CurrentTxTransferLen);
+    CurrentTxTransferLen = 0;
+
+    UartHal_TxDmaDisable();
+
+    if (UartHal_GetNextTxDmaBuffer() != NULL)
+    {
+        UartHal_DmaStartNextTxTransfer();
+    }
+}
+
+static struct RingBuffer *UartHal_GetNextTxDmaBuffer(void)
+{
+    size_t i;
+    for (i = 0; i < UART_HAL_TX_PRIORITIES_CNT; i++)
+    {
+        if (!RingBuffer_IsEmpty(&TxDmaBuffers[i]))
+        {
+            return &TxDmaBuffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t UartHal_GetRxWrittenCnt(uint32_t *p_dma_write_ptr)
+{
+    uint32_t written_cnt = __atomic_load_n(&DmaRxWrittenCnt, __ATOMIC_ACQUIRE);
+
+    *p_dma_write_ptr = written_cnt % UART_HAL_RX_BUFFER_LEN;
+
+    return written_cnt;
+}
+
+static void UartHal_UpdateRxStats(void)
+{
+    uint32_t dma_write_ptr;
+    uint32_t unread_cnt = UartHal_GetRxWrittenCnt(&dma_write_ptr) - DmaRxReadCnt;
+
+    if (unread_cnt >= UART_HAL_RX_BUFFER_LEN)
+    {
+        // DMA has overwritten data which was not read, drop the whole buffer content
+        RxOverrunsCnt++;
+        RxHighWaterMark = UART_HAL_RX_BUFFER_LEN;
+        DmaRxReadPtr    = dma_write_ptr;
+        DmaRxReadCnt += unread_cnt;
+        return;
+    }
+
+    if (unread_cnt > RxHighWaterMark)
+    {
+        RxHighWaterMark = unread_cnt;
+    }
+}
+
+static void UartHal_RxDataIrqNotify(void)
+{
+    if (RxDataIrqCb != NULL)
+    {
+        RxDataIrqCb();
+    }
+}
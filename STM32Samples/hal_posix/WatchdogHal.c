@@ -0,0 +1,25 @@
+#include "WatchdogHal.h"
+
+#include "Assert.h"
+#include "Log.h"
+
+static bool IsInitialized = false;
+
+void WatchdogHal_Init(void)
+{
+    ASSERT(!IsInitialized);
+
+    LOG_D("WatchdogHal initialization");
+
+    IsInitialized = true;
+}
+
+bool WatchdogHal_IsInitialized(void)
+{
+    return IsInitialized;
+}
+
+void WatchdogHal_Refresh(void)
+{
+    // Hung process is detected by its supervisor, e.g. the load test script
+}
@@ -13,13 +13,18 @@
 #include "Provisioning.h"
 #include "SensorReceiver.h"
 #include "SimpleScheduler.h"
+#include "Startup.h"
 #include "Switch.h"
 #include "SystemHal.h"
 #include "TimeSource.h"
 #include "Timestamp.h"
+#include "UartBaudrate.h"
+#include "UartDiagnostic.h"
 #include "UartProtocol.h"
 #include "Watchdog.h"
 
+static void SendSoftwareResetRequest(void);
+
 int main(void)
 {
     SystemHal_Init();
@@ -32,6 +37,7 @@ int main(void)
 
     Mesh_Init();
     PingPong_Init();
+    UartDiagnostic_Init();
     Attention_Init();
     LCD_Setup();
     MCU_Health_Setup();
@@ -64,11 +70,22 @@ int main(void)
         Switch_Setup();
     }
 
+    if (ENABLE_UART_BAUDRATE)
+    {
+        UartBaudrate_Init();
+    }
+
     Provisioning_Init();
 
-    UartProtocol_Send(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, NULL, 0);
+    // Modem is reset when startup waits of all modules are done
+    Startup_Start(SendSoftwareResetRequest);
 
     SimpleScheduler_Run();
 
     return 0;
 }
+
+static void SendSoftwareResetRequest(void)
+{
+    UartProtocol_Send(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, NULL, 0);
+}
@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Benchmark.h"
+#include "Checksum.c"
+
+#define BENCH_DATA_LEN (100 * 1024)
+#define BENCH_ITERATIONS 20
+
+static uint8_t Data[BENCH_DATA_LEN];
+
+// Keeps the compiler from optimizing out calculations
+static volatile uint32_t CrcSink = 0;
+
+// Reference bitwise implementation - the same as CHECKSUM_CRC_ENGINE_BITWISE
+static uint16_t BenchCalcCRC16Bitwise(uint8_t *p_data, size_t len, uint16_t crc)
+{
+    size_t i, j;
+    for (i = 0; i < len; i++)
+    {
+        uint8_t data = p_data[i];
+        for (j = 0; j < 8; j++)
+        {
+            if (((crc & 0x8000) >> 8) ^ (data & 0x80))
+            {
+                crc = (crc << 1) ^ CRC16_POLYNOMIAL;
+            }
+            else
+            {
+                crc = (crc << 1);
+            }
+            data <<= 1;
+        }
+    }
+
+    return crc;
+}
+
+static uint16_t BenchCalcCRC16ByteByByte(uint8_t *p_data, size_t len, uint16_t crc)
+{
+    size_t i;
+    for (i = 0; i < len; i++)
+    {
+        crc = Checksum_UpdateCRC16(p_data[i], crc);
+    }
+
+    return crc;
+}
+
+// Reference bitwise implementation - the same as CHECKSUM_CRC_ENGINE_BITWISE
+static uint32_t BenchCalcCRC32Bitwise(uint8_t *p_data, size_t len, uint32_t crc)
+{
+    size_t i, j;
+    for (i = 0; i < len; i++)
+    {
+        crc = crc ^ p_data[i];
+        for (j = 8; j > 0; j--)
+        {
+            crc = (crc >> 1) ^ (CRC32_POLYNOMIAL & ((crc & 1) ? 0xFFFFFFFF : 0));
+        }
+    }
+
+    return ~crc;
+}
+
+// Reference SHA256 chunk processing - 64 words message schedule and generic rounds loop
+static void BenchCalcSHA256ChunkReference(uint32_t hash[8], const uint8_t chunk[SHA256_CHUNK_SIZE])
+{
+    size_t i;
+
+    uint32_t       ah[8];
+    uint32_t       w[64];
+    const uint8_t *p = chunk;
+
+    for (i = 0; i < 16; i++)
+    {
+        w[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[3];
+        p += 4;
+    }
+
+    for (i = 16; i < 64; i++)
+    {
+        const uint32_t s0 = CalcSHA256RightRotation(w[i - 15], 7) ^ CalcSHA256RightRotation(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1 = CalcSHA256RightRotation(w[i - 2], 17) ^ CalcSHA256RightRotation(w[i - 2], 19) ^ (w[i - 2] >> 10);
+
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        ah[i] = hash[i];
+    }
+
+    for (i = 0; i < 64; i++)
+    {
+        const uint32_t s1 = CalcSHA256RightRotation(ah[4], 6) ^ CalcSHA256RightRotation(ah[4], 11) ^ CalcSHA256RightRotation(ah[4], 25);
+
+        const uint32_t ch    = (ah[4] & ah[5]) ^ (~ah[4] & ah[6]);
+        const uint32_t temp1 = ah[7] + s1 + ch + SHA256_K[i] + w[i];
+        const uint32_t s0    = CalcSHA256RightRotation(ah[0], 2) ^ CalcSHA256RightRotation(ah[0], 13) ^ CalcSHA256RightRotation(ah[0], 22);
+
+        const uint32_t maj   = (ah[0] & ah[1]) ^ (ah[0] & ah[2]) ^ (ah[1] & ah[2]);
+        const uint32_t temp2 = s0 + maj;
+
+        ah[7] = ah[6];
+        ah[6] = ah[5];
+        ah[5] = ah[4];
+        ah[4] = ah[3] + temp1;
+        ah[3] = ah[2];
+        ah[2] = ah[1];
+        ah[1] = ah[0];
+        ah[0] = temp1 + temp2;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        hash[i] += ah[i];
+    }
+}
+
+static void BenchCrc16(const char *p_label, uint16_t (*p_calc)(uint8_t *, size_t, uint16_t))
+{
+    uint16_t crc = 0xFFFF;
+    size_t   i;
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        crc = p_calc(Data, sizeof(Data), crc);
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    CrcSink ^= crc;
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+    Benchmark_PrintCycles(p_label, cycles, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+}
+
+static void BenchCrc32(const char *p_label, uint32_t (*p_calc)(uint8_t *, size_t, uint32_t))
+{
+    uint32_t crc = 0xFFFFFFFF;
+    size_t   i;
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        crc = p_calc(Data, sizeof(Data), ~crc);
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    CrcSink ^= crc;
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+    Benchmark_PrintCycles(p_label, cycles, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+}
+
+static void BenchSha256Chunks(const char *p_label, void (*p_calc)(uint32_t *, const uint8_t *))
+{
+    uint32_t hash[8];
+    size_t   i, j;
+
+    memcpy(hash, SHA256_H, sizeof(hash));
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        for (j = 0; j < sizeof(Data); j += SHA256_CHUNK_SIZE)
+        {
+            p_calc(hash, &Data[j]);
+        }
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    CrcSink ^= hash[0];
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+    Benchmark_PrintCycles(p_label, cycles, (uint64_t)BENCH_ITERATIONS * sizeof(Data));
+}
+
+static void BenchSha256(const char *p_label, size_t offset)
+{
+    uint8_t sha256[CHECKSUM_SHA256_SIZE];
+    size_t  i;
+
+    uint64_t start = Benchmark_GetTimeNs();
+
+    for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        Checksum_CalcSHA256(&Data[offset], sizeof(Data) - offset, sha256);
+    }
+
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    CrcSink ^= sha256[0];
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, (uint64_t)BENCH_ITERATIONS * (sizeof(Data) - offset));
+}
+
+int main(void)
+{
+    char   header[64];
+    size_t i;
+
+    srand(0);
+    for (i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = (uint8_t)rand();
+    }
+
+    if (BenchCalcCRC16Bitwise(Data, sizeof(Data), 0xFFFF) != Checksum_CalcCRC16(Data, sizeof(Data), 0xFFFF))
+    {
+        printf("CRC16 engine %u does not match reference implementation\n", CHECKSUM_CRC16_ENGINE);
+        return EXIT_FAILURE;
+    }
+
+    // Odd offset checks unaligned input of multi-byte engines
+    if (BenchCalcCRC32Bitwise(&Data[1], sizeof(Data) - 1, 0xFFFFFFFF) != Checksum_CalcCRC32(&Data[1], sizeof(Data) - 1, 0xFFFFFFFF))
+    {
+        printf("CRC32 engine %u does not match reference implementation\n", CHECKSUM_CRC32_ENGINE);
+        return EXIT_FAILURE;
+    }
+
+    snprintf(header, sizeof(header), "CRC16 - engine %u (100 KB)", CHECKSUM_CRC16_ENGINE);
+    Benchmark_PrintHeader(header);
+
+    BenchCrc16("Bitwise reference", BenchCalcCRC16Bitwise);
+    BenchCrc16("Checksum_CalcCRC16", Checksum_CalcCRC16);
+    BenchCrc16("Checksum_UpdateCRC16", BenchCalcCRC16ByteByByte);
+
+    snprintf(header, sizeof(header), "CRC32 - engine %u (100 KB)", CHECKSUM_CRC32_ENGINE);
+    Benchmark_PrintHeader(header);
+
+    BenchCrc32("Bitwise reference", BenchCalcCRC32Bitwise);
+    BenchCrc32("Checksum_CalcCRC32", Checksum_CalcCRC32);
+
+    Benchmark_PrintHeader("SHA256 (100 KB)");
+
+    BenchSha256Chunks("Reference chunk processing", BenchCalcSHA256ChunkReference);
+    BenchSha256Chunks("CalcSHA256Chunk", CalcSHA256Chunk);
+    BenchSha256("Checksum_CalcSHA256", 0);
+    BenchSha256("Checksum_CalcSHA256 unaligned", 1);
+
+    return EXIT_SUCCESS;
+}
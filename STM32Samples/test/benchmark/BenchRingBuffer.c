@@ -0,0 +1,748 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Atomic.c"
+#include "Benchmark.h"
+#include "RingBuffer.c"
+
+// The same size as UART TX DMA buffer in UartHal
+#define BENCH_BUFFER_LEN 1024
+
+#define BENCH_BYTES_CNT (32 * 1024 * 1024)
+#define BENCH_CHUNK_LEN 16
+#define BENCH_RECORD_MIN_LEN 7
+#define BENCH_RECORD_MAX_LEN 40
+
+// Destination buffer length for bulk dequeue, the same as UART frame length
+#define BENCH_DEQUEUE_LEN 132
+
+// Consumer starts DMA transfer when this part of the buffer is filled
+#define BENCH_DMA_THRESHOLD (BENCH_BUFFER_LEN / 4)
+
+static uint8_t Buffer[BENCH_BUFFER_LEN];
+static uint8_t Data[BENCH_RECORD_MAX_LEN];
+static uint8_t DequeueBuffer[BENCH_DEQUEUE_LEN];
+
+// Keeps the compiler from optimizing out the reads
+static volatile uint32_t ReadSink = 0;
+
+// Interrupt masking is not available on the host, only the nesting bookkeeping of the critical section is measured
+__attribute__((noinline)) void AtomicHal_IrqDisable(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+__attribute__((noinline)) void AtomicHal_IrqEnable(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+// Reference implementation - the previous ring buffer with modulo wrap around, accessed within critical section
+struct BenchRefRingBuffer
+{
+    uint8_t *p_buf;
+    size_t   buf_len;
+    size_t   wr;
+    size_t   rd;
+    size_t   end;
+};
+
+static void     BenchRefRingBuffer_IncrementWrIndex(struct BenchRefRingBuffer *p_ring_buffer, uint16_t value);
+static bool     BenchRefIsOverflow(struct BenchRefRingBuffer *p_ring_buffer, uint16_t len);
+static uint16_t BenchRefMaxQueueBufferLen(struct BenchRefRingBuffer *p_ring_buffer, uint16_t table_len);
+
+static void BenchRefRingBuffer_Init(struct BenchRefRingBuffer *p_ring_buffer, uint8_t *p_buf_pointer, size_t buf_len)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_buf_pointer != NULL));
+
+    p_ring_buffer->p_buf   = p_buf_pointer;
+    p_ring_buffer->buf_len = buf_len;
+    p_ring_buffer->wr      = 0;
+    p_ring_buffer->rd      = 0;
+    p_ring_buffer->end     = buf_len;
+}
+
+static bool BenchRefRingBuffer_IsEmpty(struct BenchRefRingBuffer *p_ring_buffer)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    return p_ring_buffer->wr == p_ring_buffer->rd;
+}
+
+static void BenchRefRingBuffer_SetWrIndex(struct BenchRefRingBuffer *p_ring_buffer, uint16_t value)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    p_ring_buffer->wr = (value) % p_ring_buffer->buf_len;
+}
+
+static void BenchRefRingBuffer_IncrementRdIndex(struct BenchRefRingBuffer *p_ring_buffer, uint16_t value)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    p_ring_buffer->rd += value;
+
+    if (p_ring_buffer->rd >= p_ring_buffer->end)
+    {
+        // Skipped tail of the buffer is dropped together with the data
+        p_ring_buffer->rd -= p_ring_buffer->end;
+        p_ring_buffer->end = p_ring_buffer->buf_len;
+    }
+}
+
+static bool BenchRefRingBuffer_ReserveContinuous(struct BenchRefRingBuffer *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_span != NULL));
+
+    size_t offset;
+
+    if (BenchRefRingBuffer_IsEmpty(p_ring_buffer))
+    {
+        // Nothing is read from the buffer, so the record can start at the beginning
+        p_ring_buffer->wr = 0;
+        p_ring_buffer->rd = 0;
+    }
+
+    // Write index must not reach the read index, as the buffer would be seen as empty
+    if (p_ring_buffer->wr < p_ring_buffer->rd)
+    {
+        if (p_ring_buffer->wr + len >= p_ring_buffer->rd)
+        {
+            return false;
+        }
+        offset = p_ring_buffer->wr;
+    }
+    else if ((p_ring_buffer->wr + len < p_ring_buffer->buf_len) || ((p_ring_buffer->wr + len == p_ring_buffer->buf_len) && (p_ring_buffer->rd != 0)))
+    {
+        offset = p_ring_buffer->wr;
+    }
+    else if (len < p_ring_buffer->rd)
+    {
+        offset = 0;
+    }
+    else
+    {
+        return false;
+    }
+
+    p_span->p_buf = &p_ring_buffer->p_buf[offset];
+    p_span->len   = len;
+
+    return true;
+}
+
+static void BenchRefRingBuffer_CommitContinuous(struct BenchRefRingBuffer *p_ring_buffer, struct RingBufferSpan *p_span)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_span != NULL));
+
+    size_t offset = p_span->p_buf - p_ring_buffer->p_buf;
+
+    if (offset != p_ring_buffer->wr)
+    {
+        // Record did not fit before the end of the buffer
+        p_ring_buffer->end = p_ring_buffer->wr;
+        p_ring_buffer->wr  = 0;
+    }
+
+    BenchRefRingBuffer_IncrementWrIndex(p_ring_buffer, p_span->len);
+}
+
+static void BenchRefRingBuffer_IncrementWrIndex(struct BenchRefRingBuffer *p_ring_buffer, uint16_t value)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    BenchRefRingBuffer_SetWrIndex(p_ring_buffer, p_ring_buffer->wr + value);
+}
+
+static bool BenchRefRingBuffer_DequeueByte(struct BenchRefRingBuffer *p_ring_buffer, uint8_t *p_read_byte)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_read_byte != NULL));
+
+    if (BenchRefRingBuffer_IsEmpty(p_ring_buffer))
+    {
+        return false;
+    }
+    *p_read_byte = p_ring_buffer->p_buf[(p_ring_buffer->rd)++];
+
+    if (p_ring_buffer->rd >= p_ring_buffer->end)
+    {
+        p_ring_buffer->rd  = 0;
+        p_ring_buffer->end = p_ring_buffer->buf_len;
+    }
+
+    return true;
+}
+
+static bool BenchRefRingBuffer_QueueBytes(struct BenchRefRingBuffer *p_ring_buffer, uint8_t *p_table, uint16_t table_len)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_table != NULL));
+
+    if (BenchRefIsOverflow(p_ring_buffer, table_len))
+    {
+        return false;
+    }
+
+    uint16_t cpy_len = BenchRefMaxQueueBufferLen(p_ring_buffer, table_len);
+    memcpy(&p_ring_buffer->p_buf[p_ring_buffer->wr], p_table, cpy_len);
+
+    if (cpy_len != table_len)
+    {
+        uint16_t rest_of_table_len = table_len - cpy_len;
+        memcpy(p_ring_buffer->p_buf, &p_table[cpy_len], rest_of_table_len);
+    }
+
+    BenchRefRingBuffer_SetWrIndex(p_ring_buffer, p_ring_buffer->wr + table_len);
+
+    return true;
+}
+
+static uint8_t *BenchRefRingBuffer_GetMaxContinuousBuffer(struct BenchRefRingBuffer *p_ring_buffer, uint16_t *p_buf_len)
+{
+    ASSERT((p_ring_buffer != NULL) && (p_buf_len != NULL));
+
+    if (p_ring_buffer->wr < p_ring_buffer->rd)
+    {
+        *p_buf_len = p_ring_buffer->end - p_ring_buffer->rd;
+    }
+    else
+    {
+        *p_buf_len = p_ring_buffer->wr - p_ring_buffer->rd;
+    }
+
+    return &p_ring_buffer->p_buf[p_ring_buffer->rd];
+}
+
+static uint16_t BenchRefRingBuffer_DataLen(struct BenchRefRingBuffer *p_ring_buffer)
+{
+    ASSERT(p_ring_buffer != NULL);
+
+    if (p_ring_buffer->wr < p_ring_buffer->rd)
+    {
+        return (p_ring_buffer->end - p_ring_buffer->rd) + p_ring_buffer->wr;
+    }
+
+    return p_ring_buffer->wr - p_ring_buffer->rd;
+}
+
+static bool BenchRefIsOverflow(struct BenchRefRingBuffer *p_ring_buffer, uint16_t len)
+{
+    // Skipped tail of the buffer is not available until the read index wraps around
+    size_t skipped_len = p_ring_buffer->buf_len - p_ring_buffer->end;
+
+    return (len + BenchRefRingBuffer_DataLen(p_ring_buffer) + skipped_len) > p_ring_buffer->buf_len;
+}
+
+static uint16_t BenchRefMaxQueueBufferLen(struct BenchRefRingBuffer *p_ring_buffer, uint16_t table_len)
+{
+    if (BenchRefIsOverflow(p_ring_buffer, table_len))
+    {
+        return 0;
+    }
+
+    if (p_ring_buffer->wr + table_len > p_ring_buffer->buf_len)
+    {
+        return p_ring_buffer->buf_len - p_ring_buffer->wr;
+    }
+    else
+    {
+        return table_len;
+    }
+}
+
+// Ring buffer operations used by the benchmark cases, critical section functions are NULL for the lock-free ring buffer
+struct BenchRingBufferOps
+{
+    void *p_ring_buffer;
+    void (*p_critical_enter)(void);
+    void (*p_critical_exit)(void);
+    bool (*p_queue_bytes)(void *p_ring_buffer, uint8_t *p_table, uint16_t table_len);
+    bool (*p_dequeue_byte)(void *p_ring_buffer, uint8_t *p_read_byte);
+    bool (*p_reserve_continuous)(void *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span);
+    void (*p_commit_continuous)(void *p_ring_buffer, struct RingBufferSpan *p_span);
+    uint8_t *(*p_get_max_continuous_buffer)(void *p_ring_buffer, uint16_t *p_buf_len);
+    void (*p_increment_rd_index)(void *p_ring_buffer, uint16_t value);
+};
+
+static struct RingBuffer         SpscRingBuffer;
+static struct BenchRefRingBuffer RefRingBuffer;
+static pthread_mutex_t           RefMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static bool BenchSpscQueueBytes(void *p_ring_buffer, uint8_t *p_table, uint16_t table_len)
+{
+    return RingBuffer_QueueBytes(p_ring_buffer, p_table, table_len);
+}
+
+static bool BenchSpscDequeueByte(void *p_ring_buffer, uint8_t *p_read_byte)
+{
+    return RingBuffer_DequeueByte(p_ring_buffer, p_read_byte);
+}
+
+static bool BenchSpscReserveContinuous(void *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span)
+{
+    return RingBuffer_ReserveContinuous(p_ring_buffer, len, p_span);
+}
+
+static void BenchSpscCommitContinuous(void *p_ring_buffer, struct RingBufferSpan *p_span)
+{
+    RingBuffer_CommitContinuous(p_ring_buffer, p_span);
+}
+
+static uint8_t *BenchSpscGetMaxContinuousBuffer(void *p_ring_buffer, uint16_t *p_buf_len)
+{
+    return RingBuffer_GetMaxContinuousBuffer(p_ring_buffer, p_buf_len);
+}
+
+static void BenchSpscIncrementRdIndex(void *p_ring_buffer, uint16_t value)
+{
+    RingBuffer_IncrementRdIndex(p_ring_buffer, value);
+}
+
+static bool BenchRefQueueBytes(void *p_ring_buffer, uint8_t *p_table, uint16_t table_len)
+{
+    return BenchRefRingBuffer_QueueBytes(p_ring_buffer, p_table, table_len);
+}
+
+static bool BenchRefDequeueByte(void *p_ring_buffer, uint8_t *p_read_byte)
+{
+    return BenchRefRingBuffer_DequeueByte(p_ring_buffer, p_read_byte);
+}
+
+static bool BenchRefReserveContinuous(void *p_ring_buffer, uint16_t len, struct RingBufferSpan *p_span)
+{
+    return BenchRefRingBuffer_ReserveContinuous(p_ring_buffer, len, p_span);
+}
+
+static void BenchRefCommitContinuous(void *p_ring_buffer, struct RingBufferSpan *p_span)
+{
+    BenchRefRingBuffer_CommitContinuous(p_ring_buffer, p_span);
+}
+
+static uint8_t *BenchRefGetMaxContinuousBuffer(void *p_ring_buffer, uint16_t *p_buf_len)
+{
+    return BenchRefRingBuffer_GetMaxContinuousBuffer(p_ring_buffer, p_buf_len);
+}
+
+static void BenchRefIncrementRdIndex(void *p_ring_buffer, uint16_t value)
+{
+    BenchRefRingBuffer_IncrementRdIndex(p_ring_buffer, value);
+}
+
+static void BenchRefMutexLock(void)
+{
+    pthread_mutex_lock(&RefMutex);
+}
+
+static void BenchRefMutexUnlock(void)
+{
+    pthread_mutex_unlock(&RefMutex);
+}
+
+static const struct BenchRingBufferOps SpscOps = {
+    .p_ring_buffer               = &SpscRingBuffer,
+    .p_critical_enter            = NULL,
+    .p_critical_exit             = NULL,
+    .p_queue_bytes               = BenchSpscQueueBytes,
+    .p_dequeue_byte              = BenchSpscDequeueByte,
+    .p_reserve_continuous        = BenchSpscReserveContinuous,
+    .p_commit_continuous         = BenchSpscCommitContinuous,
+    .p_get_max_continuous_buffer = BenchSpscGetMaxContinuousBuffer,
+    .p_increment_rd_index        = BenchSpscIncrementRdIndex,
+};
+
+// The same as UartHal and LoggerHal accessed the previous ring buffer
+static const struct BenchRingBufferOps RefOps = {
+    .p_ring_buffer               = &RefRingBuffer,
+    .p_critical_enter            = Atomic_CriticalEnter,
+    .p_critical_exit             = Atomic_CriticalExit,
+    .p_queue_bytes               = BenchRefQueueBytes,
+    .p_dequeue_byte              = BenchRefDequeueByte,
+    .p_reserve_continuous        = BenchRefReserveContinuous,
+    .p_commit_continuous         = BenchRefCommitContinuous,
+    .p_get_max_continuous_buffer = BenchRefGetMaxContinuousBuffer,
+    .p_increment_rd_index        = BenchRefIncrementRdIndex,
+};
+
+// Threads of the host process preempt each other like the main loop and interrupt, mutex stands for the critical section
+static const struct BenchRingBufferOps RefThreadOps = {
+    .p_ring_buffer               = &RefRingBuffer,
+    .p_critical_enter            = BenchRefMutexLock,
+    .p_critical_exit             = BenchRefMutexUnlock,
+    .p_queue_bytes               = BenchRefQueueBytes,
+    .p_dequeue_byte              = BenchRefDequeueByte,
+    .p_reserve_continuous        = BenchRefReserveContinuous,
+    .p_commit_continuous         = BenchRefCommitContinuous,
+    .p_get_max_continuous_buffer = BenchRefGetMaxContinuousBuffer,
+    .p_increment_rd_index        = BenchRefIncrementRdIndex,
+};
+
+static void BenchCriticalEnter(const struct BenchRingBufferOps *p_ops)
+{
+    if (p_ops->p_critical_enter != NULL)
+    {
+        p_ops->p_critical_enter();
+    }
+}
+
+static void BenchCriticalExit(const struct BenchRingBufferOps *p_ops)
+{
+    if (p_ops->p_critical_exit != NULL)
+    {
+        p_ops->p_critical_exit();
+    }
+}
+
+static void BenchInit(void)
+{
+    RingBuffer_Init(&SpscRingBuffer, Buffer, sizeof(Buffer));
+    BenchRefRingBuffer_Init(&RefRingBuffer, Buffer, sizeof(Buffer));
+}
+
+static uint16_t BenchGetRecordLen(size_t record_idx)
+{
+    return BENCH_RECORD_MIN_LEN + (record_idx * 7) % (BENCH_RECORD_MAX_LEN - BENCH_RECORD_MIN_LEN + 1);
+}
+
+// Queue chunks until the buffer is full, then read it byte by byte, as UartHal_Flush does
+static void BenchByteStream(const char *p_label, const struct BenchRingBufferOps *p_ops)
+{
+    uint8_t  byte;
+    uint32_t sum     = 0;
+    size_t   len_cnt = 0;
+    bool     status;
+
+    BenchInit();
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    while (len_cnt < BENCH_BYTES_CNT)
+    {
+        size_t queued_len;
+
+        // Reference ring buffer is seen as empty when it is filled up completely, so one chunk is always left free
+        for (queued_len = 0; queued_len + BENCH_CHUNK_LEN < BENCH_BUFFER_LEN; queued_len += BENCH_CHUNK_LEN)
+        {
+            BenchCriticalEnter(p_ops);
+            status = p_ops->p_queue_bytes(p_ops->p_ring_buffer, Data, BENCH_CHUNK_LEN);
+            BenchCriticalExit(p_ops);
+
+            if (!status)
+            {
+                break;
+            }
+        }
+        len_cnt += queued_len;
+
+        while (true)
+        {
+            BenchCriticalEnter(p_ops);
+            status = p_ops->p_dequeue_byte(p_ops->p_ring_buffer, &byte);
+            BenchCriticalExit(p_ops);
+
+            if (!status)
+            {
+                break;
+            }
+            sum += byte;
+        }
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    ReadSink ^= sum;
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, len_cnt);
+    Benchmark_PrintCycles(p_label, cycles, len_cnt);
+}
+
+// Records are reserved and committed like UART frames, DMA transfer takes the longest continuous data.
+// Bytes hold a running counter, so the order of data is verified.
+static bool BenchRecords(const char *p_label, const struct BenchRingBufferOps *p_ops)
+{
+    struct RingBufferSpan span;
+    uint8_t               wr_cnt     = 0;
+    uint8_t               rd_cnt     = 0;
+    size_t                record_idx = 0;
+    size_t                len_cnt    = 0;
+    size_t                queued_len = 0;
+    bool                  status;
+    size_t                i;
+
+    BenchInit();
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    while (len_cnt < BENCH_BYTES_CNT)
+    {
+        uint16_t record_len = BenchGetRecordLen(record_idx);
+
+        BenchCriticalEnter(p_ops);
+        status = p_ops->p_reserve_continuous(p_ops->p_ring_buffer, record_len, &span);
+        if (status)
+        {
+            for (i = 0; i < record_len; i++)
+            {
+                span.p_buf[i] = wr_cnt++;
+            }
+            p_ops->p_commit_continuous(p_ops->p_ring_buffer, &span);
+        }
+        BenchCriticalExit(p_ops);
+
+        if (status)
+        {
+            record_idx++;
+            queued_len += record_len;
+        }
+
+        if (!status || (queued_len >= BENCH_DMA_THRESHOLD))
+        {
+            uint16_t tx_len;
+
+            BenchCriticalEnter(p_ops);
+            uint8_t *p_tx_data = p_ops->p_get_max_continuous_buffer(p_ops->p_ring_buffer, &tx_len);
+            BenchCriticalExit(p_ops);
+
+            for (i = 0; i < tx_len; i++)
+            {
+                if (p_tx_data[i] != rd_cnt++)
+                {
+                    return false;
+                }
+            }
+
+            BenchCriticalEnter(p_ops);
+            p_ops->p_increment_rd_index(p_ops->p_ring_buffer, tx_len);
+            BenchCriticalExit(p_ops);
+
+            len_cnt += tx_len;
+            queued_len = (queued_len > tx_len) ? queued_len - tx_len : 0;
+        }
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    Benchmark_PrintThroughput(p_label, time_ns, record_idx, "records", len_cnt);
+    Benchmark_PrintCycles(p_label, cycles, len_cnt);
+
+    return true;
+}
+
+enum BenchConsumer
+{
+    BENCH_CONSUMER_DEQUEUE_BYTE,
+    BENCH_CONSUMER_DEQUEUE_BYTES,
+    BENCH_CONSUMER_READ_SPANS,
+};
+
+// Buffer is filled up and read with the given consumer API, so the per byte cost of reading is compared
+static void BenchConsumer(const char *p_label, enum BenchConsumer consumer)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+    uint8_t               byte;
+    uint32_t              sum     = 0;
+    size_t                len_cnt = 0;
+    uint64_t              cycles  = 0;
+    uint64_t              time_ns = 0;
+    size_t                i;
+    size_t                j;
+
+    BenchInit();
+
+    while (len_cnt < BENCH_BYTES_CNT)
+    {
+        // Chunks do not divide the buffer length, so data wraps around at different offsets
+        while (RingBuffer_QueueBytes(&SpscRingBuffer, Data, BENCH_RECORD_MAX_LEN))
+        {
+        }
+
+        uint16_t data_len = RingBuffer_DataLen(&SpscRingBuffer);
+
+        uint64_t start        = Benchmark_GetTimeNs();
+        uint64_t start_cycles = Benchmark_GetCycleCount();
+
+        switch (consumer)
+        {
+            case BENCH_CONSUMER_DEQUEUE_BYTE:
+                while (RingBuffer_DequeueByte(&SpscRingBuffer, &byte))
+                {
+                    sum += byte;
+                }
+                break;
+
+            case BENCH_CONSUMER_DEQUEUE_BYTES:
+            {
+                uint16_t len;
+                while ((len = RingBuffer_DequeueBytes(&SpscRingBuffer, DequeueBuffer, sizeof(DequeueBuffer))) != 0)
+                {
+                    for (i = 0; i < len; i++)
+                    {
+                        sum += DequeueBuffer[i];
+                    }
+                }
+                break;
+            }
+
+            case BENCH_CONSUMER_READ_SPANS:
+            default:
+            {
+                uint16_t len = RingBuffer_GetReadSpans(&SpscRingBuffer, spans);
+                for (i = 0; i < RING_BUFFER_SPANS_CNT; i++)
+                {
+                    for (j = 0; j < spans[i].len; j++)
+                    {
+                        sum += spans[i].p_buf[j];
+                    }
+                }
+                RingBuffer_IncrementRdIndex(&SpscRingBuffer, len);
+                break;
+            }
+        }
+
+        cycles += Benchmark_GetCycleCount() - start_cycles;
+        time_ns += Benchmark_GetTimeNs() - start;
+
+        len_cnt += data_len;
+    }
+
+    ReadSink ^= sum;
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, len_cnt);
+    Benchmark_PrintCycles(p_label, cycles, len_cnt);
+}
+
+static void *BenchThreadProducer(void *p_arg)
+{
+    const struct BenchRingBufferOps *p_ops = p_arg;
+
+    struct RingBufferSpan span;
+    uint8_t               wr_cnt     = 0;
+    size_t                record_idx = 0;
+    size_t                len_cnt    = 0;
+    bool                  status;
+    size_t                i;
+
+    while (len_cnt < BENCH_BYTES_CNT / 4)
+    {
+        uint16_t record_len = BenchGetRecordLen(record_idx);
+
+        BenchCriticalEnter(p_ops);
+        status = p_ops->p_reserve_continuous(p_ops->p_ring_buffer, record_len, &span);
+        BenchCriticalExit(p_ops);
+
+        if (!status)
+        {
+            sched_yield();
+            continue;
+        }
+
+        // Reference ring buffer is locked only for the index updates, the same as the lock-free one
+        for (i = 0; i < record_len; i++)
+        {
+            span.p_buf[i] = wr_cnt++;
+        }
+
+        BenchCriticalEnter(p_ops);
+        p_ops->p_commit_continuous(p_ops->p_ring_buffer, &span);
+        BenchCriticalExit(p_ops);
+
+        record_idx++;
+        len_cnt += record_len;
+    }
+
+    return NULL;
+}
+
+// Producer and consumer run in separate threads, consumer verifies the order of data
+static void BenchThreads(const char *p_label, const struct BenchRingBufferOps *p_ops)
+{
+    pthread_t producer;
+    uint8_t   rd_cnt  = 0;
+    size_t    len_cnt = 0;
+    size_t    i;
+
+    BenchInit();
+
+    uint64_t start = Benchmark_GetTimeNs();
+
+    pthread_create(&producer, NULL, BenchThreadProducer, (void *)p_ops);
+
+    while (len_cnt < BENCH_BYTES_CNT / 4)
+    {
+        uint16_t tx_len;
+
+        BenchCriticalEnter(p_ops);
+        uint8_t *p_tx_data = p_ops->p_get_max_continuous_buffer(p_ops->p_ring_buffer, &tx_len);
+        BenchCriticalExit(p_ops);
+
+        if (tx_len == 0)
+        {
+            sched_yield();
+            continue;
+        }
+
+        for (i = 0; i < tx_len; i++)
+        {
+            if (p_tx_data[i] != rd_cnt++)
+            {
+                printf("%s: data mismatch after %zu bytes\n", p_label, len_cnt + i);
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        BenchCriticalEnter(p_ops);
+        p_ops->p_increment_rd_index(p_ops->p_ring_buffer, tx_len);
+        BenchCriticalExit(p_ops);
+
+        len_cnt += tx_len;
+    }
+
+    pthread_join(producer, NULL);
+
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    Benchmark_PrintThroughput(p_label, time_ns, 0, NULL, len_cnt);
+}
+
+int main(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = (uint8_t)i;
+    }
+
+    Benchmark_PrintHeader("Ring buffer - byte stream (32 MB)");
+
+    BenchByteStream("Reference + critical section", &RefOps);
+    BenchByteStream("Lock-free SPSC", &SpscOps);
+
+    Benchmark_PrintHeader("Ring buffer - records (32 MB)");
+
+    if (!BenchRecords("Reference + critical section", &RefOps) || !BenchRecords("Lock-free SPSC", &SpscOps))
+    {
+        printf("Ring buffer data mismatch\n");
+        return EXIT_FAILURE;
+    }
+
+    Benchmark_PrintHeader("Ring buffer - consumer (32 MB)");
+
+    BenchConsumer("RingBuffer_DequeueByte", BENCH_CONSUMER_DEQUEUE_BYTE);
+    BenchConsumer("RingBuffer_DequeueBytes", BENCH_CONSUMER_DEQUEUE_BYTES);
+    BenchConsumer("RingBuffer_GetReadSpans", BENCH_CONSUMER_READ_SPANS);
+
+    Benchmark_PrintHeader("Ring buffer - records, 2 threads (8 MB)");
+
+    BenchThreads("Reference + mutex", &RefThreadOps);
+    BenchThreads("Lock-free SPSC", &SpscOps);
+
+    return EXIT_SUCCESS;
+}
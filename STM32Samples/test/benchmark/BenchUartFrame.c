@@ -0,0 +1,340 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Benchmark.h"
+#include "Checksum.c"
+#include "UartFrame.c"
+
+// The same size as RX DMA buffer in UartHal
+#define BENCH_RX_BUFFER_LEN 512
+
+#define BENCH_FRAMES_CNT 200000
+#define BENCH_STREAM_MAX_LEN (BENCH_FRAMES_CNT * UART_FRAME_FRAME_LEN(UART_FRAME_MAX_PAYLOAD_LEN))
+
+#define BENCH_BIT_ERRORS_INTERVAL 10000    // Average number of bits between bit errors
+
+static uint8_t *Stream       = NULL;
+static size_t   StreamLen    = 0;
+static size_t   StreamRdIdx  = 0;
+static size_t   HandledFrame = 0;
+
+static size_t CleanFramesCnt = 0;
+
+// UartHal stub - serves the prepared stream through the API used by UartFrame
+bool UartHal_IsInitialized(void)
+{
+    return true;
+}
+
+void UartHal_Init(void)
+{
+}
+
+void UartHal_SendBuffer(uint8_t *p_buff, size_t buff_len)
+{
+    UNUSED(p_buff);
+    UNUSED(buff_len);
+}
+
+bool UartHal_TxReserve(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation)
+{
+    static uint8_t tx_buf[UART_FRAME_FRAME_LEN(UART_FRAME_MAX_PAYLOAD_LEN)];
+
+    p_reservation->spans[0].p_buf = tx_buf;
+    p_reservation->spans[0].len   = len;
+    p_reservation->spans[1].p_buf = tx_buf;
+    p_reservation->spans[1].len   = 0;
+    p_reservation->priority       = priority;
+
+    return true;
+}
+
+void UartHal_TxCommit(struct UartHalTxReservation *p_reservation)
+{
+    UNUSED(p_reservation);
+}
+
+void UartHal_Flush(void)
+{
+}
+
+bool UartHal_IsRxDataAvailable(void)
+{
+    return StreamRdIdx < StreamLen;
+}
+
+void UartHal_SetRxDataIrq(void (*irq_cb)(void))
+{
+    UNUSED(irq_cb);
+}
+
+void UartHal_SetBaudrate(uint32_t baudrate)
+{
+    UNUSED(baudrate);
+}
+
+uint32_t UartHal_GetBaudrate(void)
+{
+    return UART_HAL_DEFAULT_BAUDRATE;
+}
+
+void UartHal_GetRxStats(struct UartHalRxStats *p_stats)
+{
+    memset(p_stats, 0, sizeof(*p_stats));
+}
+
+void UartHal_ClearRxStats(void)
+{
+}
+
+void UartHal_SetTxCoalescing(bool is_enable, uint32_t window_us)
+{
+    UNUSED(is_enable);
+    UNUSED(window_us);
+}
+
+void UartHal_ProcessPendingTx(void)
+{
+}
+
+uint32_t UartHal_GetTxDmaTransfersCnt(void)
+{
+    return 0;
+}
+
+uint16_t UartHal_GetTxFreeSpace(enum UartHalTxPriority priority)
+{
+    UNUSED(priority);
+
+    return UINT16_MAX;
+}
+
+bool UartHal_ReadByte(uint8_t *p_byte)
+{
+    if (StreamRdIdx == StreamLen)
+    {
+        return false;
+    }
+
+    *p_byte = Stream[StreamRdIdx++];
+    return true;
+}
+
+uint8_t *UartHal_GetRxMaxContinuousBuffer(uint16_t *p_buf_len)
+{
+    // Emulate circular DMA buffer - continuous buffer never crosses the end of the RX buffer
+    size_t len = BENCH_RX_BUFFER_LEN - (StreamRdIdx % BENCH_RX_BUFFER_LEN);
+    if (len > StreamLen - StreamRdIdx)
+    {
+        len = StreamLen - StreamRdIdx;
+    }
+
+    *p_buf_len = (uint16_t)len;
+    return &Stream[StreamRdIdx];
+}
+
+void UartHal_IncrementRxRdIndex(uint16_t value)
+{
+    StreamRdIdx += value;
+}
+
+static bool BenchFrameHandler(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UNUSED(p_rx_frame);
+
+    HandledFrame++;
+
+    return true;
+}
+
+static size_t BenchAppendFrame(uint8_t *p_buf, enum UartFrameCmd cmd, uint8_t len)
+{
+    p_buf[UART_FRAME_PREAMBLE_BYTE_1_OFFSET] = UART_FRAME_PREAMBLE_BYTE_1;
+    p_buf[UART_FRAME_PREAMBLE_BYTE_2_OFFSET] = UART_FRAME_PREAMBLE_BYTE_2;
+    p_buf[UART_FRAME_LEN_OFFSET]             = len;
+    p_buf[UART_FRAME_CMD_OFFSET]             = cmd;
+
+    size_t i;
+    for (i = 0; i < len; i++)
+    {
+        p_buf[UART_FRAME_PAYLOAD_OFFSET + i] = (uint8_t)rand();
+    }
+
+    uint16_t crc = UartFrame_CalculateCrc16(len, cmd, &p_buf[UART_FRAME_PAYLOAD_OFFSET]);
+
+    p_buf[UART_FRAME_CRC_BYTE_1_OFFSET(len)] = LOW_BYTE(crc);
+    p_buf[UART_FRAME_CRC_BYTE_2_OFFSET(len)] = HIGH_BYTE(crc);
+
+    return UART_FRAME_FRAME_LEN(len);
+}
+
+static void BenchPrepareStream(const char *p_name, uint8_t min_len, uint8_t max_len)
+{
+    srand(0);
+    StreamLen = 0;
+
+    size_t i;
+    for (i = 0; i < BENCH_FRAMES_CNT; i++)
+    {
+        uint8_t len = min_len + (uint8_t)(rand() % (max_len - min_len + 1));
+        StreamLen += BenchAppendFrame(&Stream[StreamLen], UART_FRAME_CMD_DFU_WRITE_DATA_EVENT, len);
+    }
+
+    Benchmark_PrintHeader(p_name);
+}
+
+static void BenchPrepareStreamWithBitErrors(const char *p_name, uint8_t min_len, uint8_t max_len)
+{
+    size_t bit_error = 0;
+
+    srand(0);
+    StreamLen      = 0;
+    CleanFramesCnt = 0;
+
+    size_t i;
+    for (i = 0; i < BENCH_FRAMES_CNT; i++)
+    {
+        uint8_t len = min_len + (uint8_t)(rand() % (max_len - min_len + 1));
+        StreamLen += BenchAppendFrame(&Stream[StreamLen], UART_FRAME_CMD_DFU_WRITE_DATA_EVENT, len);
+
+        // Bits are flipped at random intervals, so some frames have no errors and some have more than one
+        bool is_clean = true;
+        while (bit_error < StreamLen * 8)
+        {
+            Stream[bit_error / 8] ^= 1u << (bit_error % 8);
+            bit_error += 1 + (size_t)(rand() % (2 * BENCH_BIT_ERRORS_INTERVAL));
+            is_clean = false;
+        }
+
+        if (is_clean)
+        {
+            CleanFramesCnt++;
+        }
+    }
+
+    Benchmark_PrintHeader(p_name);
+    printf("%-32s %10zu frames\n", "Frames without bit errors", CleanFramesCnt);
+}
+
+static void BenchBitErrors(const char *p_label, bool is_bulk, bool is_resync)
+{
+    static struct UartFrameRxTxFrame rx_frame ALIGN(4);
+
+    StreamRdIdx  = 0;
+    HandledFrame = 0;
+    FrameByteCnt = 0;
+    ResyncLen    = 0;
+    ResyncIdx    = 0;
+
+    while ((StreamRdIdx != StreamLen) || (ResyncIdx < ResyncLen))
+    {
+        if (is_bulk)
+        {
+            UartFrame_ProcessIncomingDataBulk(&rx_frame, BenchFrameHandler);
+        }
+        else if (UartFrame_ProcessIncomingData(&rx_frame))
+        {
+            BenchFrameHandler(&rx_frame);
+        }
+
+        if (!is_resync)
+        {
+            // Bytes of invalid frames are dropped, as the decoder did before resynchronization was added
+            ResyncLen = 0;
+            ResyncIdx = 0;
+        }
+    }
+
+    printf("%-32s %10zu frames %9.3f %% delivered\n", p_label, HandledFrame, 100.0 * (double)HandledFrame / BENCH_FRAMES_CNT);
+
+    if (is_resync && (HandledFrame < CleanFramesCnt))
+    {
+        printf("Frames without bit errors lost: %zu\n", CleanFramesCnt - HandledFrame);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void BenchByteByByte(void)
+{
+    static struct UartFrameRxTxFrame rx_frame ALIGN(4);
+
+    StreamRdIdx  = 0;
+    HandledFrame = 0;
+
+    uint64_t start = Benchmark_GetTimeNs();
+
+    while (StreamRdIdx != StreamLen)
+    {
+        if (UartFrame_ProcessIncomingData(&rx_frame))
+        {
+            BenchFrameHandler(&rx_frame);
+        }
+    }
+
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    if (HandledFrame != BENCH_FRAMES_CNT)
+    {
+        printf("Byte by byte decoder lost frames: %zu\n", BENCH_FRAMES_CNT - HandledFrame);
+        exit(EXIT_FAILURE);
+    }
+
+    Benchmark_PrintThroughput("UartFrame_ProcessIncomingData", time_ns, HandledFrame, "frames", StreamLen);
+}
+
+static void BenchBulk(void)
+{
+    static struct UartFrameRxTxFrame rx_frame ALIGN(4);
+
+    StreamRdIdx  = 0;
+    HandledFrame = 0;
+
+    uint64_t start = Benchmark_GetTimeNs();
+
+    while (StreamRdIdx != StreamLen)
+    {
+        UartFrame_ProcessIncomingDataBulk(&rx_frame, BenchFrameHandler);
+    }
+
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    if (HandledFrame != BENCH_FRAMES_CNT)
+    {
+        printf("Bulk decoder lost frames: %zu\n", BENCH_FRAMES_CNT - HandledFrame);
+        exit(EXIT_FAILURE);
+    }
+
+    Benchmark_PrintThroughput("UartFrame_ProcessIncomingDataBulk", time_ns, HandledFrame, "frames", StreamLen);
+}
+
+int main(void)
+{
+    Stream = malloc(BENCH_STREAM_MAX_LEN);
+    if (Stream == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    BenchPrepareStream("UartFrame decoding - short frames (0-16 B payload)", 0, 16);
+    BenchByteByByte();
+    BenchBulk();
+
+    BenchPrepareStream("UartFrame decoding - DFU frames (64-127 B payload)", 64, UART_FRAME_MAX_PAYLOAD_LEN);
+    BenchByteByByte();
+    BenchBulk();
+
+    BenchPrepareStreamWithBitErrors("UartFrame decoding - random bit errors, short frames (0-16 B payload)", 0, 16);
+    BenchBitErrors("Without resynchronization", false, false);
+    BenchBitErrors("UartFrame_ProcessIncomingData", false, true);
+    BenchBitErrors("UartFrame_ProcessIncomingDataBulk", true, true);
+
+    BenchPrepareStreamWithBitErrors("UartFrame decoding - random bit errors, DFU frames (64-127 B payload)", 64, UART_FRAME_MAX_PAYLOAD_LEN);
+    BenchBitErrors("Without resynchronization", false, false);
+    BenchBitErrors("UartFrame_ProcessIncomingData", false, true);
+    BenchBitErrors("UartFrame_ProcessIncomingDataBulk", true, true);
+
+    free(Stream);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,203 @@
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "Atomic.c"
+#include "Benchmark.h"
+#include "RingBuffer.c"
+#include "UartFrame.h"
+#include "../../hal_posix/AtomicHal.c"
+#include "../../hal_posix/UartHal.c"
+
+#define BENCH_ROUNDS_CNT 200
+#define BENCH_ROUND_PERIOD_NS 10000000u    // Scheduler rounds with traffic, idle rounds in between only poll pending TX
+#define BENCH_IDLE_ROUND_NS 100000u
+#define BENCH_CORE_CLOCK_HZ 72000000u
+#define BENCH_COALESCING_WINDOW_US 1000
+
+#define BENCH_FRAME_OVERHEAD_LEN 6    // Preamble, length, command and CRC
+#define BENCH_MESH_MESSAGE_LEN 14     // Instance index, sub-index, opcode and status parameters
+#define BENCH_SENSOR_UPDATE_LEN 4     // PIR and ALS - sensor input index, property ID and value
+#define BENCH_ENERGY_UPDATE_LEN 6     // Voltage, current, power and energy - sensor input index, property ID and value
+#define BENCH_PONG_LEN 2
+#define BENCH_ENERGY_PROPERTIES_CNT 4
+
+static int      PeerFd       = -1;
+static uint64_t PeerBytesCnt = 0;
+static uint64_t SentBytesCnt = 0;
+static size_t   SentFrames   = 0;
+
+// Core clock and clock tick stubs - the clock tick counts core cycles of the 72 MHz MCU
+uint32_t SystemHal_GetCoreClock(void)
+{
+    return BENCH_CORE_CLOCK_HZ;
+}
+
+uint32_t TickHal_GetClockTick(void)
+{
+    return (uint32_t)(Benchmark_GetTimeNs() * (BENCH_CORE_CLOCK_HZ / 1000000u) / 1000u);
+}
+
+uint32_t Timestamp_GetCurrent(void)
+{
+    return (uint32_t)(Benchmark_GetTimeNs() / 1000000u);
+}
+
+void LoggerHal_Flush(void)
+{
+}
+
+// Modem stand-in - only counts received bytes
+static void *BenchPeerThread(void *p_arg)
+{
+    UNUSED(p_arg);
+
+    uint8_t buf[256];
+
+    while (true)
+    {
+        ssize_t len = read(PeerFd, buf, sizeof(buf));
+        if (len <= 0)
+        {
+            break;
+        }
+
+        __atomic_add_fetch(&PeerBytesCnt, (uint64_t)len, __ATOMIC_RELEASE);
+    }
+
+    return NULL;
+}
+
+static void BenchWaitUntil(uint64_t time_ns)
+{
+    while (Benchmark_GetTimeNs() < time_ns)
+    {
+        UartHal_ProcessPendingTx();
+        usleep(BENCH_IDLE_ROUND_NS / 1000u);
+    }
+}
+
+// Only frame lengths matter for the number of DMA transfers, payload and CRC bytes are not encoded
+static void BenchSendFrame(enum UartFrameCmd cmd, uint8_t len, enum UartHalTxPriority priority)
+{
+    struct UartHalTxReservation reservation;
+    uint16_t                    frame_len = BENCH_FRAME_OVERHEAD_LEN + len;
+
+    while (!UartHal_TxReserve(frame_len, priority, &reservation))
+    {
+        // TX buffer is full, the application waits until the transfer in progress is finished
+        UartHal_ProcessPendingTx();
+        usleep(BENCH_IDLE_ROUND_NS / 1000u);
+    }
+
+    memset(reservation.spans[0].p_buf, 0, frame_len);
+    reservation.spans[0].p_buf[0] = 0xAA;
+    reservation.spans[0].p_buf[1] = 0x55;
+    reservation.spans[0].p_buf[2] = len;
+    reservation.spans[0].p_buf[3] = cmd;
+
+    UartHal_TxCommit(&reservation);
+
+    SentBytesCnt += frame_len;
+    SentFrames++;
+}
+
+// Frame mix of the server - mesh message responses every round, PIR and ALS every 2nd round, energy every 4th round and pong every 10th round
+static void BenchSendRoundFrames(size_t round)
+{
+    size_t i;
+
+    BenchSendFrame(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, BENCH_MESH_MESSAGE_LEN, UART_HAL_TX_PRIORITY_NORMAL);
+
+    if ((round % 2) == 0)
+    {
+        BenchSendFrame(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, BENCH_SENSOR_UPDATE_LEN, UART_HAL_TX_PRIORITY_NORMAL);
+        BenchSendFrame(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, BENCH_SENSOR_UPDATE_LEN, UART_HAL_TX_PRIORITY_NORMAL);
+    }
+
+    if ((round % 4) == 0)
+    {
+        for (i = 0; i < BENCH_ENERGY_PROPERTIES_CNT; i++)
+        {
+            BenchSendFrame(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, BENCH_ENERGY_UPDATE_LEN, UART_HAL_TX_PRIORITY_NORMAL);
+        }
+    }
+
+    if ((round % 10) == 0)
+    {
+        BenchSendFrame(UART_FRAME_CMD_PONG_RESPONSE, BENCH_PONG_LEN, UART_HAL_TX_PRIORITY_HIGH);
+    }
+}
+
+static void BenchTxCoalescing(const char *p_label, bool is_enable, uint32_t window_us)
+{
+    UartHal_SetTxCoalescing(is_enable, window_us);
+
+    SentBytesCnt = 0;
+    SentFrames   = 0;
+
+    uint64_t peer_bytes_start    = __atomic_load_n(&PeerBytesCnt, __ATOMIC_ACQUIRE);
+    uint32_t dma_transfers_start = UartHal_GetTxDmaTransfersCnt();
+    uint64_t start               = Benchmark_GetTimeNs();
+
+    size_t round;
+    for (round = 0; round < BENCH_ROUNDS_CNT; round++)
+    {
+        BenchSendRoundFrames(round);
+        BenchWaitUntil(start + (uint64_t)(round + 1) * BENCH_ROUND_PERIOD_NS);
+    }
+
+    UartHal_Flush();
+
+    uint64_t time_ns       = Benchmark_GetTimeNs() - start;
+    uint32_t dma_transfers = UartHal_GetTxDmaTransfersCnt() - dma_transfers_start;
+
+    while (__atomic_load_n(&PeerBytesCnt, __ATOMIC_ACQUIRE) - peer_bytes_start < SentBytesCnt)
+    {
+        usleep(BENCH_IDLE_ROUND_NS / 1000u);
+    }
+
+    // Line is busy only part of the time, so the throughput in bytes is not reported
+    Benchmark_PrintThroughput(p_label, time_ns, dma_transfers, "dma_transfers", 0);
+    printf("%-32s %10zu frames %8u bytes %8u dma_transfers %6.2f frames/transfer\n",
+           "",
+           SentFrames,
+           (unsigned int)SentBytesCnt,
+           (unsigned int)dma_transfers,
+           (double)SentFrames / dma_transfers);
+}
+
+int main(void)
+{
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    char fd_str[16];
+    snprintf(fd_str, sizeof(fd_str), "%d", fds[0]);
+    setenv(UART_HAL_ENV_FD, fd_str, 1);
+
+    PeerFd = fds[1];
+
+    pthread_t peer_thread;
+    if (pthread_create(&peer_thread, NULL, BenchPeerThread, NULL) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    UartHal_Init();
+
+    Benchmark_PrintHeader("UartHal TX DMA transfers - server frame mix, default baud rate with pacing");
+    BenchTxCoalescing("Coalescing off", false, 0);
+    BenchTxCoalescing("Coalescing on", true, 0);
+    BenchTxCoalescing("Coalescing on, 1000 us window", true, BENCH_COALESCING_WINDOW_US);
+
+    return EXIT_SUCCESS;
+}
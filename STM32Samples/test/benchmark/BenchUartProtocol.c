@@ -0,0 +1,655 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Benchmark.h"
+#include "UartProtocol.c"
+
+#define BENCH_ROUNDS_CNT 200000
+
+// Number of mesh opcodes registered by every model in the many models case
+#define BENCH_MODEL_OPCODES_CNT (UART_PROTOCOL_MAX_NUMBER_OF_MESH_OPCODES / UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS)
+
+// Instance indices assigned by the modem to the modules filtering them
+#define BENCH_HEALTH_INSTANCE_INDEX 1
+#define BENCH_TIME_SOURCE_INSTANCE_INDEX 2
+#define BENCH_SENSOR_RECEIVER_INSTANCE_INDEX 3
+#define BENCH_EMG_L_TEST_INSTANCE_INDEX 4
+#define BENCH_LUMINAIRE_INSTANCE_INDEX 5
+
+// RX queue drain - handlers and other scheduler tasks busy wait to emulate their time on the MCU
+#define BENCH_DRAIN_ROUNDS_CNT 20
+#define BENCH_DRAIN_QUEUED_FRAMES_CNT 64
+#define BENCH_DRAIN_HANDLER_TIME_NS 20000
+#define BENCH_DRAIN_OTHER_TASKS_TIME_NS 100000
+#define BENCH_CORE_CLOCK_MHZ 72
+#define BENCH_NS_IN_US 1000
+
+static size_t HandledFramesCnt = 0;
+
+static struct UartFrameRxTxFrame *RxQueuedFrame     = NULL;
+static size_t                     RxQueuedFramesCnt = 0;
+
+// UartFrame, scheduler, startup and timestamp stubs - only dispatching of the frames is measured, RX buffer holds copies of a single queued frame
+bool UartFrame_IsInitialized(void)
+{
+    return true;
+}
+
+void UartFrame_Init(void)
+{
+}
+
+void UartFrame_Send(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    UNUSED(cmd);
+    UNUSED(p_payload);
+    UNUSED(len);
+}
+
+void UartFrame_SendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    UNUSED(cmd);
+    UNUSED(p_segments);
+    UNUSED(segments_cnt);
+}
+
+bool UartFrame_TrySend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    UNUSED(cmd);
+    UNUSED(p_payload);
+    UNUSED(len);
+
+    return true;
+}
+
+bool UartFrame_TrySendV(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt)
+{
+    UNUSED(cmd);
+    UNUSED(p_segments);
+    UNUSED(segments_cnt);
+
+    return true;
+}
+
+bool UartFrame_IsTxSpaceAvailable(enum UartFrameCmd cmd, uint8_t len)
+{
+    UNUSED(cmd);
+    UNUSED(len);
+
+    return true;
+}
+
+void UartFrame_Flush(void)
+{
+}
+
+void UartFrame_SetBaudrate(uint32_t baudrate)
+{
+    UNUSED(baudrate);
+}
+
+uint32_t UartFrame_GetBaudrate(void)
+{
+    return 0;
+}
+
+void UartFrame_GetRxStats(struct UartFrameRxStats *p_stats)
+{
+    UNUSED(p_stats);
+}
+
+void UartFrame_ClearRxStats(void)
+{
+}
+
+void UartFrame_GetTxStats(struct UartFrameTxStats *p_stats)
+{
+    UNUSED(p_stats);
+}
+
+bool UartFrame_ProcessIncomingData(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UNUSED(p_rx_frame);
+
+    return false;
+}
+
+size_t UartFrame_ProcessIncomingDataBulk(struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler)
+{
+    size_t frames_cnt = 0;
+
+    while (RxQueuedFramesCnt > 0)
+    {
+        *p_rx_frame = *RxQueuedFrame;
+        RxQueuedFramesCnt--;
+        frames_cnt++;
+
+        if (!p_frame_handler(p_rx_frame))
+        {
+            break;
+        }
+    }
+
+    return frames_cnt;
+}
+
+bool UartFrame_IsRxDataAvailable(void)
+{
+    return RxQueuedFramesCnt > 0;
+}
+
+void UartFrame_SetRxDataCallback(void (*p_callback)(void))
+{
+    UNUSED(p_callback);
+}
+
+void UartFrame_SetTxCoalescing(bool is_enabled, uint32_t window_us)
+{
+    UNUSED(is_enabled);
+    UNUSED(window_us);
+}
+
+void UartFrame_ProcessPendingTx(void)
+{
+}
+
+void SimpleScheduler_TaskAdd(uint32_t period, void (*p_task)(void), enum SimpleSchedulerTaskId task_id, bool is_enabled)
+{
+    UNUSED(period);
+    UNUSED(p_task);
+    UNUSED(task_id);
+    UNUSED(is_enabled);
+}
+
+void SimpleScheduler_TaskStateChange(enum SimpleSchedulerTaskId task_id, bool is_enabled)
+{
+    UNUSED(task_id);
+    UNUSED(is_enabled);
+}
+
+void Startup_AddSequence(const struct StartupSequence *p_sequence)
+{
+    UNUSED(p_sequence);
+}
+
+uint32_t Timestamp_GetCurrent(void)
+{
+    return 0;
+}
+
+// Ticks of the MCU core clock, so the RX budget takes the same time as on the MCU
+uint32_t TickHal_GetClockTick(void)
+{
+    return (uint32_t)(Benchmark_GetTimeNs() * BENCH_CORE_CLOCK_MHZ / BENCH_NS_IN_US);
+}
+
+static void BenchBusyWait(uint64_t time_ns)
+{
+    uint64_t start = Benchmark_GetTimeNs();
+
+    while ((Benchmark_GetTimeNs() - start) < time_ns)
+    {
+    }
+}
+
+__attribute__((noinline)) static void BenchUartMessageHandler(struct UartFrameRxTxFrame *p_frame)
+{
+    UNUSED(p_frame);
+
+    HandledFramesCnt++;
+}
+
+static void BenchDrainUartMessageHandler(struct UartFrameRxTxFrame *p_frame)
+{
+    UNUSED(p_frame);
+
+    BenchBusyWait(BENCH_DRAIN_HANDLER_TIME_NS);
+
+    HandledFramesCnt++;
+}
+
+__attribute__((noinline)) static void BenchMeshMessageHandler(struct UartProtocolFrameMeshMessageFrame *p_frame)
+{
+    UNUSED(p_frame);
+
+    HandledFramesCnt++;
+}
+
+// Command lists of the production modules
+static const enum UartFrameCmd ProvisioningCommandList[] = {
+    UART_FRAME_CMD_INIT_DEVICE_EVENT,
+    UART_FRAME_CMD_CREATE_INSTANCES_RESPONSE,
+    UART_FRAME_CMD_INIT_NODE_EVENT,
+    UART_FRAME_CMD_START_NODE_RESPONSE,
+    UART_FRAME_CMD_MESH_MESSAGE_REQUEST,
+    UART_FRAME_CMD_ERROR,
+    UART_FRAME_CMD_MODEM_FIRMWARE_VERSION_RESPONSE,
+    UART_FRAME_CMD_FIRMWARE_VERSION_SET_RESP,
+};
+
+static const enum UartFrameCmd AttentionCommandList[] = {UART_FRAME_CMD_ATTENTION_EVENT};
+
+static const enum UartFrameCmd McuDfuCommandList[] = {
+    UART_FRAME_CMD_DFU_INIT_REQ,
+    UART_FRAME_CMD_DFU_STATUS_REQ,
+    UART_FRAME_CMD_DFU_PAGE_CREATE_REQ,
+    UART_FRAME_CMD_DFU_WRITE_DATA_EVENT,
+    UART_FRAME_CMD_DFU_PAGE_STORE_REQ,
+    UART_FRAME_CMD_DFU_STATE_CHECK_RESP,
+    UART_FRAME_CMD_DFU_CANCEL_RESP,
+};
+
+static const enum UartFrameCmd McuHealthCommandList[] = {UART_FRAME_CMD_START_TEST_REQ};
+
+static const enum UartFrameCmd PingPongCommandList[] = {UART_FRAME_CMD_PING_REQUEST};
+
+static const enum UartFrameCmd SensorReceiverCommandList[] = {UART_FRAME_CMD_FACTORY_RESET_EVENT};
+
+static const enum UartFrameCmd TimeSourceCommandList[] = {
+    UART_FRAME_CMD_TIME_SOURCE_SET_REQ,
+    UART_FRAME_CMD_TIME_SOURCE_GET_REQ,
+};
+
+static const enum UartFrameCmd UartBaudrateCommandList[] = {
+    UART_FRAME_CMD_INIT_DEVICE_EVENT,
+    UART_FRAME_CMD_INIT_NODE_EVENT,
+    UART_FRAME_CMD_BAUDRATE_SET_RESP,
+    UART_FRAME_CMD_PONG_RESPONSE,
+};
+
+static const enum UartFrameCmd UartDiagnosticCommandList[] = {
+    UART_FRAME_CMD_RX_STATS_REQ,
+    UART_FRAME_CMD_TX_STATS_REQ,
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    UART_FRAME_CMD_HANDLER_STATS_REQ,
+#endif
+};
+
+// Mesh opcode lists of the production modules
+static const uint32_t EmgLTestOpcodeList[] = {MESH_MESSAGE_LIGHT_EL, MESH_MESSAGE_LIGHT_EL_TEST};
+
+static const uint32_t LuminaireOpcodeList[] = {UART_PROTOCOL_MESH_MESSAGE_OPCODE_LIGHT_L_STATUS, UART_PROTOCOL_MESH_MESSAGE_OPCODE_LIGHT_CTL_TEMPERATURE_STATUS};
+
+static const uint32_t SensorReceiverOpcodeList[] = {MESH_MESSAGE_SENSOR_STATUS};
+
+#define BENCH_UART_HANDLER_CONFIG(command_list, index)            \
+    {                                                             \
+        .p_uart_message_handler       = BenchUartMessageHandler,  \
+        .p_mesh_message_handler       = NULL,                     \
+        .p_uart_frame_command_list    = command_list,             \
+        .p_mesh_message_opcode_list   = NULL,                     \
+        .uart_frame_command_list_len  = ARRAY_SIZE(command_list), \
+        .mesh_message_opcode_list_len = 0,                        \
+        .instance_index               = index,                    \
+    }
+
+#define BENCH_MESH_HANDLER_CONFIG(opcode_list, opcode_list_len, index) \
+    {                                                                  \
+        .p_uart_message_handler       = NULL,                          \
+        .p_mesh_message_handler       = BenchMeshMessageHandler,       \
+        .p_uart_frame_command_list    = NULL,                          \
+        .p_mesh_message_opcode_list   = opcode_list,                   \
+        .uart_frame_command_list_len  = 0,                             \
+        .mesh_message_opcode_list_len = opcode_list_len,               \
+        .instance_index               = index,                         \
+    }
+
+// All modules registering message handlers, in the order of initialization in main
+static struct UartProtocolHandlerConfig ProductionHandlerConfigs[] = {
+    BENCH_UART_HANDLER_CONFIG(UartBaudrateCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(UartDiagnosticCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(ProvisioningCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(McuHealthCommandList, BENCH_HEALTH_INSTANCE_INDEX),
+    BENCH_UART_HANDLER_CONFIG(AttentionCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(PingPongCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(McuDfuCommandList, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN),
+    BENCH_UART_HANDLER_CONFIG(TimeSourceCommandList, BENCH_TIME_SOURCE_INSTANCE_INDEX),
+    BENCH_UART_HANDLER_CONFIG(SensorReceiverCommandList, BENCH_SENSOR_RECEIVER_INSTANCE_INDEX),
+    BENCH_MESH_HANDLER_CONFIG(EmgLTestOpcodeList, ARRAY_SIZE(EmgLTestOpcodeList), BENCH_EMG_L_TEST_INSTANCE_INDEX),
+    BENCH_MESH_HANDLER_CONFIG(LuminaireOpcodeList, ARRAY_SIZE(LuminaireOpcodeList), BENCH_LUMINAIRE_INSTANCE_INDEX),
+    BENCH_MESH_HANDLER_CONFIG(SensorReceiverOpcodeList, ARRAY_SIZE(SensorReceiverOpcodeList), BENCH_SENSOR_RECEIVER_INSTANCE_INDEX),
+};
+
+static struct UartProtocolHandlerConfig DrainHandlerConfig = {
+    .p_uart_message_handler      = BenchDrainUartMessageHandler,
+    .p_uart_frame_command_list   = PingPongCommandList,
+    .uart_frame_command_list_len = ARRAY_SIZE(PingPongCommandList),
+    .instance_index              = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
+};
+
+// Many models case - the maximal number of handlers with the maximal number of mesh opcodes
+static uint32_t                         ModelOpcodeList[UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS][BENCH_MODEL_OPCODES_CNT];
+static struct UartProtocolHandlerConfig ModelHandlerConfigs[UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS];
+
+// Reference implementation - the previous dispatch, scanning command and opcode lists of all handlers
+static void BenchRefCallAllMeshHandlers(struct UartProtocolHandlerConfig *p_handler_config_row, struct UartProtocolFrameMeshMessageFrame *p_mesh_message_frame)
+{
+    if ((p_handler_config_row->p_mesh_message_opcode_list == NULL) || (p_handler_config_row->p_mesh_message_handler == NULL))
+    {
+        return;
+    }
+
+    size_t k;
+    for (k = 0; k < p_handler_config_row->mesh_message_opcode_list_len; k++)
+    {
+        if (p_mesh_message_frame->mesh_opcode == p_handler_config_row->p_mesh_message_opcode_list[k])
+        {
+            p_handler_config_row->p_mesh_message_handler(p_mesh_message_frame);
+        }
+    }
+}
+
+static void BenchRefCallAllUartCommandHandlers(struct UartProtocolHandlerConfig *p_handler_config_row, struct UartFrameRxTxFrame *p_rx_frame)
+{
+    if ((p_handler_config_row->p_uart_frame_command_list == NULL) || (p_handler_config_row->p_uart_message_handler == NULL))
+    {
+        return;
+    }
+
+    size_t k;
+    for (k = 0; k < p_handler_config_row->uart_frame_command_list_len; k++)
+    {
+        if (p_rx_frame->cmd == p_handler_config_row->p_uart_frame_command_list[k])
+        {
+            p_handler_config_row->p_uart_message_handler(p_rx_frame);
+        }
+    }
+}
+
+static void BenchRefDispatchFrame(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    uint8_t instance_index = UartProtocol_CheckIfInstanceIndexExist(p_rx_frame);
+
+    struct UartProtocolFrameMeshMessageFrame mesh_message_frame = {0};
+
+    bool is_mesh_message_frame_valid = UartProtocol_ParseMeshMessageRequest(p_rx_frame, &mesh_message_frame);
+
+    size_t i;
+    for (i = 0; i < HandlerConfigCnt; i++)
+    {
+        if ((HandlerConfig[i]->instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) && (instance_index != UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN) &&
+            (HandlerConfig[i]->instance_index != instance_index))
+        {
+            continue;
+        }
+
+        if (is_mesh_message_frame_valid)
+        {
+            BenchRefCallAllMeshHandlers(HandlerConfig[i], &mesh_message_frame);
+            continue;
+        }
+
+        BenchRefCallAllUartCommandHandlers(HandlerConfig[i], p_rx_frame);
+    }
+}
+
+static bool BenchRefProcessSingleFrame(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UartProtocol_DispatchFrame(p_rx_frame);
+
+    return false;
+}
+
+static bool BenchRefProcessAllFrames(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UartProtocol_DispatchFrame(p_rx_frame);
+
+    return true;
+}
+
+// Single frame per task run, as the byte by byte decoder did
+static void BenchRefProcessIncomingDataSingleFrame(void)
+{
+    static struct UartFrameRxTxFrame rx_frame ALIGN(4);
+
+    UartFrame_ProcessIncomingDataBulk(&rx_frame, BenchRefProcessSingleFrame);
+}
+
+// All frames in a single task run, as the bulk decoder did without the RX budget
+static void BenchRefProcessIncomingDataAllFrames(void)
+{
+    static struct UartFrameRxTxFrame rx_frame ALIGN(4);
+
+    UartFrame_ProcessIncomingDataBulk(&rx_frame, BenchRefProcessAllFrames);
+}
+
+// Every valid command except mesh messages, which are dispatched by the opcode
+static size_t BenchPrepareFrames(struct UartFrameRxTxFrame *p_frames)
+{
+    size_t frames_cnt = 0;
+    size_t cmd;
+
+    for (cmd = 0; cmd <= UINT8_MAX; cmd++)
+    {
+        if ((UartProtocol_GetCommandIndex(cmd) == UART_PROTOCOL_INVALID_CMD_INDEX) || (cmd == UART_FRAME_CMD_MESH_MESSAGE_REQUEST) ||
+            (cmd == UART_FRAME_CMD_MESH_MESSAGE_REQUEST1))
+        {
+            continue;
+        }
+
+        memset(&p_frames[frames_cnt], 0, sizeof(p_frames[frames_cnt]));
+        p_frames[frames_cnt].cmd          = cmd;
+        p_frames[frames_cnt].p_payload[0] = BENCH_HEALTH_INSTANCE_INDEX;
+        frames_cnt++;
+    }
+
+    return frames_cnt;
+}
+
+static void BenchPrepareMeshFrame(struct UartFrameRxTxFrame *p_frame, uint32_t opcode, uint8_t instance_index)
+{
+    size_t opcode_len = (opcode > UINT16_MAX) ? 3 : ((opcode > UINT8_MAX) ? 2 : 1);
+    size_t i;
+
+    memset(p_frame, 0, sizeof(*p_frame));
+
+    p_frame->cmd          = UART_FRAME_CMD_MESH_MESSAGE_REQUEST1;
+    p_frame->p_payload[0] = instance_index;
+    p_frame->p_payload[1] = 0;
+
+    // Opcode is big endian
+    for (i = 0; i < opcode_len; i++)
+    {
+        p_frame->p_payload[2 + i] = (uint8_t)(opcode >> (8 * (opcode_len - 1 - i)));
+    }
+
+    p_frame->len = 2 + opcode_len;
+}
+
+// Mesh messages with opcodes of the production modules, addressed to their instances
+static size_t BenchPrepareProductionMeshFrames(struct UartFrameRxTxFrame *p_frames)
+{
+    size_t frames_cnt = 0;
+    size_t i;
+    size_t k;
+
+    for (i = 0; i < ARRAY_SIZE(ProductionHandlerConfigs); i++)
+    {
+        for (k = 0; k < ProductionHandlerConfigs[i].mesh_message_opcode_list_len; k++)
+        {
+            BenchPrepareMeshFrame(&p_frames[frames_cnt++], ProductionHandlerConfigs[i].p_mesh_message_opcode_list[k], ProductionHandlerConfigs[i].instance_index);
+        }
+    }
+
+    return frames_cnt;
+}
+
+// Every model registers 2 byte opcodes of the same group, e.g. generic status messages
+static size_t BenchPrepareModelMeshFrames(struct UartFrameRxTxFrame *p_frames)
+{
+    size_t frames_cnt = 0;
+    size_t i;
+    size_t k;
+
+    for (i = 0; i < UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS; i++)
+    {
+        for (k = 0; k < BENCH_MODEL_OPCODES_CNT; k++)
+        {
+            ModelOpcodeList[i][k] = 0x8200 + i * BENCH_MODEL_OPCODES_CNT + k;
+        }
+
+        struct UartProtocolHandlerConfig config = BENCH_MESH_HANDLER_CONFIG(ModelOpcodeList[i], BENCH_MODEL_OPCODES_CNT, i);
+        ModelHandlerConfigs[i]                  = config;
+
+        BenchPrepareMeshFrame(&p_frames[frames_cnt++], ModelOpcodeList[i][0], i);
+    }
+
+    return frames_cnt;
+}
+
+static void BenchRegisterHandlers(struct UartProtocolHandlerConfig *p_configs, size_t configs_cnt)
+{
+    size_t i;
+
+    HandlerConfigCnt   = 0;
+    MeshOpcodeIndexCnt = 0;
+    memset(CommandHandlers, 0, sizeof(CommandHandlers));
+
+    for (i = 0; i < configs_cnt; i++)
+    {
+        UartProtocol_RegisterMessageHandler(&p_configs[i]);
+    }
+}
+
+static size_t BenchDispatch(const char *p_label, UartProtocolUartMessageHandler_T p_dispatch, struct UartFrameRxTxFrame *p_frames, size_t frames_cnt)
+{
+    size_t round;
+    size_t i;
+
+    HandledFramesCnt = 0;
+
+    uint64_t start        = Benchmark_GetTimeNs();
+    uint64_t start_cycles = Benchmark_GetCycleCount();
+
+    for (round = 0; round < BENCH_ROUNDS_CNT; round++)
+    {
+        for (i = 0; i < frames_cnt; i++)
+        {
+            p_dispatch(&p_frames[i]);
+        }
+    }
+
+    uint64_t cycles  = Benchmark_GetCycleCount() - start_cycles;
+    uint64_t time_ns = Benchmark_GetTimeNs() - start;
+
+    Benchmark_PrintItemCost(p_label, time_ns, cycles, BENCH_ROUNDS_CNT * frames_cnt, "frame");
+
+    return HandledFramesCnt;
+}
+
+static bool BenchCompare(const char *p_name, struct UartFrameRxTxFrame *p_frames, size_t frames_cnt)
+{
+    Benchmark_PrintHeader(p_name);
+
+    size_t ref_handled_cnt = BenchDispatch("Reference - handler list scan", BenchRefDispatchFrame, p_frames, frames_cnt);
+    size_t handled_cnt     = BenchDispatch("UartProtocol_DispatchFrame", UartProtocol_DispatchFrame, p_frames, frames_cnt);
+
+    if ((handled_cnt != ref_handled_cnt) || (handled_cnt == 0))
+    {
+        printf("Handled frames mismatch: %zu, reference: %zu\n", handled_cnt, ref_handled_cnt);
+        return false;
+    }
+
+    return true;
+}
+
+// Scheduler rounds with the UART protocol task and other tasks, until all queued frames are processed
+static bool BenchDrain(const char *p_label, void (*p_task)(void), struct UartFrameRxTxFrame *p_frame)
+{
+    uint64_t time_ns         = 0;
+    size_t   task_runs       = 0;
+    size_t   max_task_frames = 0;
+    size_t   round;
+
+    HandledFramesCnt = 0;
+    RxQueuedFrame    = p_frame;
+
+    for (round = 0; round < BENCH_DRAIN_ROUNDS_CNT; round++)
+    {
+        RxQueuedFramesCnt = BENCH_DRAIN_QUEUED_FRAMES_CNT;
+
+        uint64_t start = Benchmark_GetTimeNs();
+
+        while (true)
+        {
+            // Frames handled in a single run are counted instead of its time, which is disturbed by the host scheduler
+            size_t handled_cnt = HandledFramesCnt;
+            p_task();
+            size_t task_frames = HandledFramesCnt - handled_cnt;
+
+            if (task_frames > max_task_frames)
+            {
+                max_task_frames = task_frames;
+            }
+            task_runs++;
+
+            if (RxQueuedFramesCnt == 0)
+            {
+                break;
+            }
+
+            BenchBusyWait(BENCH_DRAIN_OTHER_TASKS_TIME_NS);
+        }
+
+        time_ns += Benchmark_GetTimeNs() - start;
+    }
+
+    printf("%-32s %10.3f ms drain %8.1f task runs %8zu max frames/run %8.3f ms handlers/run\n",
+           p_label,
+           (double)time_ns / BENCH_DRAIN_ROUNDS_CNT / 1000000.0,
+           (double)task_runs / BENCH_DRAIN_ROUNDS_CNT,
+           max_task_frames,
+           (double)(max_task_frames * BENCH_DRAIN_HANDLER_TIME_NS) / 1000000.0);
+
+    if (HandledFramesCnt != BENCH_DRAIN_ROUNDS_CNT * BENCH_DRAIN_QUEUED_FRAMES_CNT)
+    {
+        printf("Handled frames mismatch: %zu, expected: %u\n", HandledFramesCnt, BENCH_DRAIN_ROUNDS_CNT * BENCH_DRAIN_QUEUED_FRAMES_CNT);
+        return false;
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static struct UartFrameRxTxFrame frames[UART_PROTOCOL_CMD_CNT] ALIGN(4);
+
+    BenchRegisterHandlers(ProductionHandlerConfigs, ARRAY_SIZE(ProductionHandlerConfigs));
+
+    if (!BenchCompare("UartProtocol dispatch - all commands, production handlers", frames, BenchPrepareFrames(frames)))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (!BenchCompare("UartProtocol dispatch - mesh messages, production handlers", frames, BenchPrepareProductionMeshFrames(frames)))
+    {
+        return EXIT_FAILURE;
+    }
+
+    size_t frames_cnt = BenchPrepareModelMeshFrames(frames);
+    BenchRegisterHandlers(ModelHandlerConfigs, ARRAY_SIZE(ModelHandlerConfigs));
+
+    if (!BenchCompare("UartProtocol dispatch - mesh messages, 16 models", frames, frames_cnt))
+    {
+        return EXIT_FAILURE;
+    }
+
+    static struct UartFrameRxTxFrame ping_frame ALIGN(4) = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_PING_REQUEST,
+    };
+
+    BenchRegisterHandlers(&DrainHandlerConfig, 1);
+
+    Benchmark_PrintHeader("UartProtocol RX queue drain - 64 frames, 20 us handler, 100 us other tasks per scheduler round");
+
+    if (!BenchDrain("Reference - single frame per run", BenchRefProcessIncomingDataSingleFrame, &ping_frame) ||
+        !BenchDrain("Reference - all frames per run", BenchRefProcessIncomingDataAllFrames, &ping_frame) ||
+        !BenchDrain("UartProtocol_ProcessIncomingData", UartProtocol_ProcessIncomingData, &ping_frame))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "Benchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "Assert.h"
+
+#define BENCHMARK_NS_IN_S 1000000000.0
+#define BENCHMARK_BYTES_IN_MB (1024.0 * 1024.0)
+
+uint64_t Benchmark_GetTimeNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t Benchmark_GetCycleCount(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    // Time stamp counter runs at constant rate, so it is only an approximation of core cycles
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+void Benchmark_PrintHeader(const char *p_name)
+{
+    printf("--------------------------\n");
+    printf("%s\n", p_name);
+    printf("--------------------------\n");
+}
+
+void Benchmark_PrintThroughput(const char *p_label, uint64_t time_ns, uint64_t items, const char *p_item_unit, uint64_t bytes)
+{
+    double time_s = (double)time_ns / BENCHMARK_NS_IN_S;
+
+    printf("%-32s %10.3f ms", p_label, (double)time_ns / 1000000.0);
+
+    if (items != 0)
+    {
+        printf(" %14.0f %s/s", (double)items / time_s, p_item_unit);
+    }
+
+    if (bytes != 0)
+    {
+        printf(" %10.2f MB/s %8.2f ns/B", (double)bytes / BENCHMARK_BYTES_IN_MB / time_s, (double)time_ns / (double)bytes);
+    }
+
+    printf("\n");
+}
+
+void Benchmark_PrintCycles(const char *p_label, uint64_t cycles, uint64_t bytes)
+{
+    if ((cycles == 0) || (bytes == 0))
+    {
+        return;
+    }
+
+    printf("%-32s %14.0f cycles %8.2f cycles/B\n", p_label, (double)cycles, (double)cycles / (double)bytes);
+}
+
+void Benchmark_PrintItemCost(const char *p_label, uint64_t time_ns, uint64_t cycles, uint64_t items, const char *p_item_unit)
+{
+    if (items == 0)
+    {
+        return;
+    }
+
+    printf("%-32s %10.2f ns/%s", p_label, (double)time_ns / (double)items, p_item_unit);
+
+    if (cycles != 0)
+    {
+        printf(" %10.1f cycles/%s", (double)cycles / (double)items, p_item_unit);
+    }
+
+    printf("\n");
+}
+
+void Assert_Callback(uint32_t pc)
+{
+    printf("ASSERT ERROR, pc@0x%08X\n", (unsigned int)pc);
+    exit(EXIT_FAILURE);
+}
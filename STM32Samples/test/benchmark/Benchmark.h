@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ *  Get monotonic time
+ *
+ *  @return             Current time in nanoseconds
+ */
+uint64_t Benchmark_GetTimeNs(void);
+
+/*
+ *  Get CPU cycle counter
+ *
+ *  @return             Current value of time stamp counter, 0 if not supported on the host
+ */
+uint64_t Benchmark_GetCycleCount(void);
+
+/*
+ *  Print benchmark section header
+ *
+ *  @param p_name       Benchmark name
+ */
+void Benchmark_PrintHeader(const char *p_name);
+
+/*
+ *  Print throughput of a single benchmark case
+ *
+ *  @param p_label      Benchmark case label
+ *  @param time_ns      Measured time in nanoseconds
+ *  @param items        Number of processed items, 0 if not applicable
+ *  @param p_item_unit  Item unit name, e.g. "frames"
+ *  @param bytes        Number of processed bytes
+ */
+void Benchmark_PrintThroughput(const char *p_label, uint64_t time_ns, uint64_t items, const char *p_item_unit, uint64_t bytes);
+
+/*
+ *  Print cycle cost of a single benchmark case
+ *
+ *  @param p_label      Benchmark case label
+ *  @param cycles       Measured number of cycles
+ *  @param bytes        Number of processed bytes
+ */
+void Benchmark_PrintCycles(const char *p_label, uint64_t cycles, uint64_t bytes);
+
+/*
+ *  Print cost of a single item of benchmark case, e.g. a dispatched frame
+ *
+ *  @param p_label      Benchmark case label
+ *  @param time_ns      Measured time in nanoseconds
+ *  @param cycles       Measured number of cycles, 0 if not supported on the host
+ *  @param items        Number of processed items
+ *  @param p_item_unit  Item unit name, e.g. "frame"
+ */
+void Benchmark_PrintItemCost(const char *p_label, uint64_t time_ns, uint64_t cycles, uint64_t items, const char *p_item_unit);
+
+#endif
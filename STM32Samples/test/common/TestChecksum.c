@@ -2,6 +2,59 @@
 #include "unity.h"
 
 
+#define CRC16_REFERENCE_POLYNOMIAL 0x8005
+#define CRC32_REFERENCE_POLYNOMIAL 0xEDB88320
+#define CRC_REFERENCE_DATA_LEN 1024
+
+static void FillPseudoRandom(uint8_t *p_data, size_t len)
+{
+    uint32_t seed = 0x12345678;
+    size_t   i;
+    for (i = 0; i < len; i++)
+    {
+        seed      = seed * 1103515245 + 12345;
+        p_data[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+static uint16_t CalcCRC16Reference(uint8_t *p_data, size_t len, uint16_t crc)
+{
+    size_t i, j;
+    for (i = 0; i < len; i++)
+    {
+        uint8_t data = p_data[i];
+        for (j = 0; j < 8; j++)
+        {
+            if (((crc & 0x8000) >> 8) ^ (data & 0x80))
+            {
+                crc = (crc << 1) ^ CRC16_REFERENCE_POLYNOMIAL;
+            }
+            else
+            {
+                crc = (crc << 1);
+            }
+            data <<= 1;
+        }
+    }
+
+    return crc;
+}
+
+static uint32_t CalcCRC32Reference(uint8_t *p_data, size_t len, uint32_t crc)
+{
+    size_t i, j;
+    for (i = 0; i < len; i++)
+    {
+        crc ^= p_data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = (crc & 1) ? ((crc >> 1) ^ CRC32_REFERENCE_POLYNOMIAL) : (crc >> 1);
+        }
+    }
+
+    return ~crc;
+}
+
 void setUp(void)
 {
 }
@@ -57,6 +110,56 @@ void test_Checksum_CalcCRC16_MultipleDataBuffs(void)
     TEST_ASSERT_EQUAL_UINT16(crc_expected, crc_calculated);
 }
 
+void test_Checksum_CalcCRC16_CheckString(void)
+{
+    uint16_t checksum_init_val = 0xFFFF;
+    uint8_t  data[]            = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    size_t   len               = sizeof(data);
+    uint16_t crc_expected      = 0xAEE7;
+    uint16_t crc_calculated    = Checksum_CalcCRC16(data, len, checksum_init_val);
+    TEST_ASSERT_EQUAL_UINT16(crc_expected, crc_calculated);
+}
+
+void test_Checksum_CalcCRC16_AllBytesAllInitValsMatchReference(void)
+{
+    uint32_t init_val;
+    uint32_t data;
+    for (init_val = 0; init_val <= 0xFFFF; init_val += 0x0101)
+    {
+        for (data = 0; data <= 0xFF; data++)
+        {
+            uint8_t byte = (uint8_t)data;
+            TEST_ASSERT_EQUAL_UINT16(CalcCRC16Reference(&byte, sizeof(byte), init_val), Checksum_CalcCRC16(&byte, sizeof(byte), init_val));
+        }
+    }
+}
+
+void test_Checksum_CalcCRC16_PseudoRandomDataMatchReference(void)
+{
+    uint8_t data[CRC_REFERENCE_DATA_LEN];
+    size_t  i;
+    FillPseudoRandom(data, sizeof(data));
+
+    for (i = 0; i <= sizeof(data); i += 67)
+    {
+        TEST_ASSERT_EQUAL_UINT16(CalcCRC16Reference(data, i, 0xFFFF), Checksum_CalcCRC16(data, i, 0xFFFF));
+        TEST_ASSERT_EQUAL_UINT16(CalcCRC16Reference(data, i, 0x0000), Checksum_CalcCRC16(data, i, 0x0000));
+    }
+}
+
+void test_Checksum_UpdateCRC16_MatchBufferCalculation(void)
+{
+    uint8_t  data[]         = {0xAA, 0x55, 0x00, 0xFF, 0x12, 0x34, 0x56, 0x78, 0x80, 0x01};
+    uint16_t crc_calculated = 0xFFFF;
+    size_t   i;
+    for (i = 0; i < sizeof(data); i++)
+    {
+        crc_calculated = Checksum_UpdateCRC16(data[i], crc_calculated);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(Checksum_CalcCRC16(data, sizeof(data), 0xFFFF), crc_calculated);
+}
+
 void test_Checksum_CalcCRC32_NullData(void)
 {
     uint32_t checksum_init_val = 0xFFFFFFFF;
@@ -104,6 +207,65 @@ void test_Checksum_CalcCRC32_MultipleDataBuffs(void)
     TEST_ASSERT_EQUAL_UINT32(crc_expected, crc_calculated);
 }
 
+void test_Checksum_CalcCRC32_CheckString(void)
+{
+    uint32_t checksum_init_val = 0xFFFFFFFF;
+    uint8_t  data[]            = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    size_t   len               = sizeof(data);
+    uint32_t crc_expected      = 0xCBF43926;
+    uint32_t crc_calculated    = Checksum_CalcCRC32(data, len, checksum_init_val);
+    TEST_ASSERT_EQUAL_UINT32(crc_expected, crc_calculated);
+}
+
+void test_Checksum_CalcCRC32_AllBytesMatchReference(void)
+{
+    uint32_t init_vals[] = {0xFFFFFFFF, 0x00000000, 0x12345678, 0x80000001};
+    uint32_t data;
+    size_t   i;
+    for (i = 0; i < sizeof(init_vals) / sizeof(init_vals[0]); i++)
+    {
+        for (data = 0; data <= 0xFF; data++)
+        {
+            uint8_t byte = (uint8_t)data;
+            TEST_ASSERT_EQUAL_UINT32(CalcCRC32Reference(&byte, sizeof(byte), init_vals[i]), Checksum_CalcCRC32(&byte, sizeof(byte), init_vals[i]));
+        }
+    }
+}
+
+void test_Checksum_CalcCRC32_PseudoRandomDataMatchReference(void)
+{
+    uint8_t data[CRC_REFERENCE_DATA_LEN];
+    size_t  offset;
+    size_t  len;
+    FillPseudoRandom(data, sizeof(data));
+
+    // Check all alignments and lengths not divisible by 4 for multi-byte engines
+    for (offset = 0; offset < 4; offset++)
+    {
+        for (len = 0; len <= (sizeof(data) - offset); len += 13)
+        {
+            TEST_ASSERT_EQUAL_UINT32(CalcCRC32Reference(&data[offset], len, 0xFFFFFFFF), Checksum_CalcCRC32(&data[offset], len, 0xFFFFFFFF));
+        }
+    }
+}
+
+void test_Checksum_CalcCRC32_SplitDataMatchSingleBuffer(void)
+{
+    uint8_t  data[CRC_REFERENCE_DATA_LEN];
+    uint32_t crc_expected;
+    uint32_t crc_calculated;
+    size_t   split;
+    FillPseudoRandom(data, sizeof(data));
+
+    crc_expected = Checksum_CalcCRC32(data, sizeof(data), 0xFFFFFFFF);
+    for (split = 0; split <= sizeof(data); split += 31)
+    {
+        crc_calculated = Checksum_CalcCRC32(data, split, 0xFFFFFFFF);
+        crc_calculated = Checksum_CalcCRC32(&data[split], sizeof(data) - split, ~crc_calculated);
+        TEST_ASSERT_EQUAL_UINT32(crc_expected, crc_calculated);
+    }
+}
+
 void test_Checksum_CalcSHA256_EmptyData(void)
 {
     uint8_t data[]              = {};
@@ -129,3 +291,90 @@ void test_Checksum_CalcSHA256_SingleDataBuf(void)
     Checksum_CalcSHA256(data, len, sha256_calculated);
     TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected, sha256_calculated, sizeof(sha256_expected));
 }
+
+void test_Checksum_CalcSHA256_PaddingBoundaries(void)
+{
+    uint8_t data[CRC_REFERENCE_DATA_LEN];
+    uint8_t sha256_expected_55[32] = {0x77, 0xB3, 0x36, 0xBF, 0xF7, 0x96, 0xF2, 0x24, 0x40, 0x6E, 0x80, 0x0D, 0x60, 0x47, 0x80, 0x1E,
+                                      0xD9, 0xE8, 0xED, 0x34, 0xA4, 0xD8, 0x7C, 0x44, 0x7A, 0x2E, 0x27, 0x24, 0x3A, 0x12, 0x7A, 0xAD};
+    uint8_t sha256_expected_56[32] = {0x82, 0x23, 0x18, 0xBC, 0x36, 0xC6, 0xF2, 0x05, 0xC6, 0x93, 0x44, 0xAF, 0x03, 0xFB, 0x62, 0x54,
+                                      0xDC, 0xD5, 0xC9, 0x8E, 0x71, 0x2B, 0xB9, 0x13, 0xC5, 0x62, 0x25, 0xC2, 0x0E, 0x61, 0x49, 0x2D};
+    uint8_t sha256_calculated[32];
+    FillPseudoRandom(data, sizeof(data));
+
+    // 55 bytes is the longest message with padding and length in a single chunk
+    Checksum_CalcSHA256(data, 55, sha256_calculated);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected_55, sha256_calculated, sizeof(sha256_expected_55));
+
+    Checksum_CalcSHA256(data, 56, sha256_calculated);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected_56, sha256_calculated, sizeof(sha256_expected_56));
+}
+
+void test_Checksum_UpdateSHA256_ChunkBoundaries(void)
+{
+    uint8_t data[CRC_REFERENCE_DATA_LEN];
+    uint8_t sha256_expected[32] = {0x0F, 0x11, 0xF4, 0x42, 0xB8, 0x6E, 0xE6, 0xCB, 0x65, 0x69, 0x67, 0xB3, 0xC8, 0xF0, 0x0B, 0x1C,
+                                   0xE4, 0xCC, 0xE8, 0x45, 0x40, 0x10, 0x39, 0xE0, 0xCC, 0x5E, 0x48, 0x71, 0x6F, 0x04, 0x51, 0xB8};
+    size_t  update_lens[]       = {1, 3, 55, 56, 63, 64, 65, 100, 127, 1000, 1024};
+    uint8_t sha256_calculated[32];
+    size_t  i;
+    FillPseudoRandom(data, sizeof(data));
+
+    Checksum_CalcSHA256(data, sizeof(data), sha256_calculated);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected, sha256_calculated, sizeof(sha256_expected));
+
+    for (i = 0; i < sizeof(update_lens) / sizeof(update_lens[0]); i++)
+    {
+        struct ChecksumSHA256Context ctx;
+        size_t                       offset = 0;
+
+        Checksum_InitSHA256(&ctx);
+        while (offset < sizeof(data))
+        {
+            size_t len = sizeof(data) - offset;
+            if (len > update_lens[i])
+            {
+                len = update_lens[i];
+            }
+
+            Checksum_UpdateSHA256(&ctx, &data[offset], len);
+            offset += len;
+        }
+        Checksum_FinalSHA256(&ctx, sha256_calculated);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected, sha256_calculated, sizeof(sha256_expected));
+    }
+}
+
+void test_Checksum_UpdateSHA256_EmptyUpdates(void)
+{
+    uint8_t data[]              = {0x12, 0x34, 0x56, 0x78};
+    uint8_t sha256_expected[32] = {
+        0xB2, 0xED, 0x99, 0x21, 0x86, 0xA5, 0xCB, 0x19, 0xF6, 0x66, 0x8A, 0xAD, 0xE8, 0x21, 0xF5, 0x02,
+        0xC1, 0xD0, 0x09, 0x70, 0xDF, 0xD0, 0xE3, 0x51, 0x28, 0xD5, 0x1B, 0xAC, 0x46, 0x49, 0x91, 0x6C,
+    };
+    uint8_t sha256_calculated[32];
+
+    struct ChecksumSHA256Context ctx;
+
+    Checksum_InitSHA256(&ctx);
+    Checksum_UpdateSHA256(&ctx, NULL, 0);
+    Checksum_UpdateSHA256(&ctx, data, 2);
+    Checksum_UpdateSHA256(&ctx, data, 0);
+    Checksum_UpdateSHA256(&ctx, &data[2], 2);
+    Checksum_FinalSHA256(&ctx, sha256_calculated);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected, sha256_calculated, sizeof(sha256_expected));
+}
+
+void test_Checksum_CalcSHA256_UnalignedData(void)
+{
+    uint8_t data[CRC_REFERENCE_DATA_LEN];
+    uint8_t sha256_expected[32] = {0xBD, 0xD2, 0x82, 0x49, 0xB4, 0x6E, 0xD0, 0x57, 0x2D, 0x50, 0x33, 0xB3, 0xF9, 0xD9, 0x1B, 0x12,
+                                   0xF2, 0x71, 0x25, 0x25, 0x27, 0x40, 0x2C, 0xB7, 0xA0, 0x28, 0x5D, 0x2C, 0x6C, 0x43, 0xF8, 0x8A};
+    uint8_t sha256_calculated[32];
+    FillPseudoRandom(data, sizeof(data));
+
+    Checksum_CalcSHA256(&data[1], sizeof(data) - 1, sha256_calculated);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(sha256_expected, sha256_calculated, sizeof(sha256_expected));
+}
@@ -20,6 +20,7 @@ void test_Init(void)
 {
     TEST_ASSERT_EQUAL(RingBuffer.p_buf, ByteBuffer);
     TEST_ASSERT_EQUAL(RingBuffer.buf_len, sizeof(ByteBuffer));
+    TEST_ASSERT_EQUAL(RingBuffer.mask, sizeof(ByteBuffer) - 1);
     TEST_ASSERT_EQUAL(RingBuffer.wr, 0);
     TEST_ASSERT_EQUAL(RingBuffer.rd, 0);
 }
@@ -30,6 +31,12 @@ void test_InitNull(void)
     RingBuffer_Init(&RingBuffer, NULL, sizeof(ByteBuffer));
 }
 
+void test_InitNotPowerOfTwo(void)
+{
+    Assert_Callback_ExpectAnyArgs();
+    RingBuffer_Init(&RingBuffer, ByteBuffer, sizeof(ByteBuffer) - 1);
+}
+
 void test_IsEmpty(void)
 {
     TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
@@ -38,28 +45,68 @@ void test_IsEmpty(void)
     TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), false);
 }
 
-void test_SetWrIndex(void)
+void test_IncrementWrIndex(void)
 {
-    RingBuffer_SetWrIndex(&RingBuffer, 15);
+    RingBuffer_IncrementWrIndex(&RingBuffer, 15);
     TEST_ASSERT_EQUAL(RingBuffer.wr, 15);
 
-    RingBuffer_SetWrIndex(&RingBuffer, 16);
-    TEST_ASSERT_EQUAL(RingBuffer.wr, 0);
+    // Indices are free running, they are wrapped around only when the buffer is accessed
+    RingBuffer.rd = 15;
 
-    RingBuffer_SetWrIndex(&RingBuffer, 17);
-    TEST_ASSERT_EQUAL(RingBuffer.wr, 1);
+    RingBuffer_IncrementWrIndex(&RingBuffer, 1);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 16);
+
+    RingBuffer_IncrementWrIndex(&RingBuffer, 1);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 17);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 2);
 }
 
 void test_IncrementRdIndex(void)
 {
+    RingBuffer.wr = 17;
+
     RingBuffer_IncrementRdIndex(&RingBuffer, 15);
     TEST_ASSERT_EQUAL(RingBuffer.rd, 15);
 
     RingBuffer_IncrementRdIndex(&RingBuffer, 1);
-    TEST_ASSERT_EQUAL(RingBuffer.rd, 0);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, 16);
 
     RingBuffer_IncrementRdIndex(&RingBuffer, 1);
-    TEST_ASSERT_EQUAL(RingBuffer.rd, 1);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, 17);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+}
+
+void test_IncrementRdIndexOverflow(void)
+{
+    RingBuffer.wr = 4;
+
+    Assert_Callback_ExpectAnyArgs();
+    RingBuffer_IncrementRdIndex(&RingBuffer, 5);
+}
+
+void test_IndexOverflow(void)
+{
+    uint8_t bytes[4] = {1, 2, 3, 4};
+    uint8_t byte;
+    size_t  i;
+
+    RingBuffer.wr = SIZE_MAX - 1;
+    RingBuffer.rd = SIZE_MAX - 1;
+
+    // Free running indices overflow together, the data length is still their difference
+    TEST_ASSERT_EQUAL(RingBuffer_QueueBytes(&RingBuffer, bytes, sizeof(bytes)), true);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 2);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), sizeof(bytes));
+    TEST_ASSERT_EQUAL(ByteBuffer[BYTE_BUFFER_LEN - 2], 1);
+    TEST_ASSERT_EQUAL(ByteBuffer[1], 4);
+
+    for (i = 0; i < sizeof(bytes); i++)
+    {
+        TEST_ASSERT_EQUAL(RingBuffer_DequeueByte(&RingBuffer, &byte), true);
+        TEST_ASSERT_EQUAL(byte, bytes[i]);
+    }
+
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
 }
 
 void test_DequeueByteEmpty(void)
@@ -219,10 +266,12 @@ void test_DataLen(void)
 
     TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 15);
 
+    // Full buffer is distinguished from the empty one
     uint8_t byte    = i;
     bool    ret_val = RingBuffer_QueueBytes(&RingBuffer, &byte, sizeof(byte));
     TEST_ASSERT_EQUAL(ret_val, true);
-    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 0);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), BYTE_BUFFER_LEN);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), false);
 }
 
 void test_IsOverflow(void)
@@ -257,3 +306,355 @@ void test_MaxQueueBufferLen(void)
 
     TEST_ASSERT_EQUAL(MaxQueueBufferLen(&RingBuffer, 4), 4);
 }
+
+void test_Reserve(void)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    bool ret_val = RingBuffer_Reserve(&RingBuffer, 4, spans);
+    TEST_ASSERT_EQUAL(ret_val, true);
+    TEST_ASSERT_EQUAL(spans[0].p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(spans[0].len, 4);
+    TEST_ASSERT_EQUAL(spans[1].len, 0);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 0);
+
+    memset(spans[0].p_buf, 0xAB, spans[0].len);
+    RingBuffer_IncrementWrIndex(&RingBuffer, 4);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 4);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 4);
+
+    uint8_t byte;
+    RingBuffer_DequeueByte(&RingBuffer, &byte);
+    TEST_ASSERT_EQUAL(byte, 0xAB);
+}
+
+void test_ReserveWrapAround(void)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 12;
+
+    bool ret_val = RingBuffer_Reserve(&RingBuffer, 6, spans);
+    TEST_ASSERT_EQUAL(ret_val, true);
+    TEST_ASSERT_EQUAL(spans[0].p_buf, &ByteBuffer[12]);
+    TEST_ASSERT_EQUAL(spans[0].len, 4);
+    TEST_ASSERT_EQUAL(spans[1].p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(spans[1].len, 2);
+
+    RingBuffer_IncrementWrIndex(&RingBuffer, spans[0].len + spans[1].len);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, BYTE_BUFFER_LEN + 2);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 6);
+}
+
+void test_ReserveOverflow(void)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    uint8_t bytes[12] = {0};
+    RingBuffer_QueueBytes(&RingBuffer, bytes, sizeof(bytes));
+
+    TEST_ASSERT_EQUAL(RingBuffer_Reserve(&RingBuffer, 5, spans), false);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 12);
+    TEST_ASSERT_EQUAL(RingBuffer_Reserve(&RingBuffer, 4, spans), true);
+}
+
+void test_ReserveContinuous(void)
+{
+    struct RingBufferSpan span;
+
+    bool ret_val = RingBuffer_ReserveContinuous(&RingBuffer, 4, &span);
+    TEST_ASSERT_EQUAL(ret_val, true);
+    TEST_ASSERT_EQUAL(span.p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(span.len, 4);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 0);
+
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, 4);
+    TEST_ASSERT_EQUAL(RingBuffer.end, BYTE_BUFFER_LEN);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 4);
+}
+
+void test_ReserveContinuousSkipTail(void)
+{
+    struct RingBufferSpan span;
+    uint8_t              *p_buffer;
+    uint16_t              buff_len;
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 8;
+
+    bool ret_val = RingBuffer_ReserveContinuous(&RingBuffer, 6, &span);
+    TEST_ASSERT_EQUAL(ret_val, true);
+    TEST_ASSERT_EQUAL(span.p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(span.len, 6);
+
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+    TEST_ASSERT_EQUAL(RingBuffer.wr, BYTE_BUFFER_LEN + 6);
+    TEST_ASSERT_EQUAL(RingBuffer.end, 12);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 10);
+
+    // Data before the skipped tail is read first
+    p_buffer = RingBuffer_GetMaxContinuousBuffer(&RingBuffer, &buff_len);
+    TEST_ASSERT_EQUAL(p_buffer, &ByteBuffer[8]);
+    TEST_ASSERT_EQUAL(buff_len, 4);
+
+    RingBuffer_IncrementRdIndex(&RingBuffer, buff_len);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 6);
+
+    // Record is read as a whole
+    p_buffer = RingBuffer_GetMaxContinuousBuffer(&RingBuffer, &buff_len);
+    TEST_ASSERT_EQUAL(p_buffer, ByteBuffer);
+    TEST_ASSERT_EQUAL(buff_len, 6);
+}
+
+void test_ReserveContinuousSkipTailDequeueByte(void)
+{
+    struct RingBufferSpan span;
+    uint8_t               byte;
+    size_t                i;
+
+    RingBuffer.wr  = 14;
+    RingBuffer.rd  = 13;
+    ByteBuffer[13] = 0xAA;
+
+    RingBuffer_ReserveContinuous(&RingBuffer, 3, &span);
+    memset(span.p_buf, 0x55, span.len);
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+
+    RingBuffer_DequeueByte(&RingBuffer, &byte);
+    TEST_ASSERT_EQUAL(byte, 0xAA);
+
+    for (i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(RingBuffer_DequeueByte(&RingBuffer, &byte), true);
+        TEST_ASSERT_EQUAL(byte, 0x55);
+    }
+
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+}
+
+void test_ReserveContinuousEmpty(void)
+{
+    struct RingBufferSpan span;
+    uint16_t              buff_len;
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 12;
+
+    // Tail of the empty buffer is skipped, so the whole buffer is available
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), BYTE_BUFFER_LEN);
+
+    bool ret_val = RingBuffer_ReserveContinuous(&RingBuffer, BYTE_BUFFER_LEN, &span);
+    TEST_ASSERT_EQUAL(ret_val, true);
+    TEST_ASSERT_EQUAL(span.p_buf, ByteBuffer);
+
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, 12);
+    TEST_ASSERT_EQUAL(RingBuffer.end, 12);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), BYTE_BUFFER_LEN);
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), 0);
+
+    uint8_t *p_buffer = RingBuffer_GetMaxContinuousBuffer(&RingBuffer, &buff_len);
+    TEST_ASSERT_EQUAL(p_buffer, ByteBuffer);
+    TEST_ASSERT_EQUAL(buff_len, BYTE_BUFFER_LEN);
+
+    RingBuffer_IncrementRdIndex(&RingBuffer, buff_len);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+}
+
+void test_ReserveContinuousOverflow(void)
+{
+    struct RingBufferSpan span;
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 4;
+
+    // Neither the tail nor the beginning of the buffer is long enough
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 5, &span), false);
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 4, &span), true);
+    TEST_ASSERT_EQUAL(span.p_buf, &ByteBuffer[12]);
+
+    RingBuffer.wr = 14;
+
+    // Write index can reach the read index, full buffer is not seen as empty
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 5, &span), false);
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 4, &span), true);
+    TEST_ASSERT_EQUAL(span.p_buf, ByteBuffer);
+
+    RingBuffer.wr = BYTE_BUFFER_LEN + 2;
+    RingBuffer.rd = 4;
+
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 3, &span), false);
+    TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 2, &span), true);
+}
+
+void test_QueueBytesSkippedTail(void)
+{
+    struct RingBufferSpan span;
+    uint8_t               bytes[4] = {0};
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 8;
+
+    RingBuffer_ReserveContinuous(&RingBuffer, 6, &span);
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+
+    // Only bytes between write and read index are free, skipped tail is not
+    TEST_ASSERT_EQUAL(RingBuffer_QueueBytes(&RingBuffer, bytes, 3), false);
+    TEST_ASSERT_EQUAL(RingBuffer_QueueBytes(&RingBuffer, bytes, 2), true);
+}
+
+void test_GetMaxContinuousFreeLen(void)
+{
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), BYTE_BUFFER_LEN);
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 4;
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), 4);
+
+    RingBuffer.wr = 14;
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), 4);
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 0;
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), 4);
+
+    RingBuffer.wr = BYTE_BUFFER_LEN + 2;
+    RingBuffer.rd = 4;
+    TEST_ASSERT_EQUAL(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer), 2);
+}
+
+void test_ReserveContinuousUntilFull(void)
+{
+    struct RingBufferSpan span;
+    uint8_t               byte;
+    size_t                i;
+
+    // Records are queued and partially read until the buffer is saturated
+    for (i = 0; i < 4 * BYTE_BUFFER_LEN; i++)
+    {
+        bool is_space_available = RingBuffer_GetMaxContinuousFreeLen(&RingBuffer) >= 5;
+
+        TEST_ASSERT_EQUAL(RingBuffer_ReserveContinuous(&RingBuffer, 5, &span), is_space_available);
+        if (!is_space_available)
+        {
+            break;
+        }
+
+        RingBuffer_CommitContinuous(&RingBuffer, &span);
+        RingBuffer_DequeueByte(&RingBuffer, &byte);
+    }
+
+    TEST_ASSERT_TRUE(i < 4 * BYTE_BUFFER_LEN);
+    TEST_ASSERT_TRUE(RingBuffer_GetMaxContinuousFreeLen(&RingBuffer) < 5);
+}
+
+void test_DequeueBytes(void)
+{
+    uint8_t bytes[6] = {1, 2, 3, 4, 5, 6};
+    uint8_t read_bytes[8];
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 12;
+
+    RingBuffer_QueueBytes(&RingBuffer, bytes, sizeof(bytes));
+
+    TEST_ASSERT_EQUAL(RingBuffer_DequeueBytes(&RingBuffer, read_bytes, 2), 2);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, read_bytes, 2);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, 14);
+
+    // Data is copied across the end of the buffer and only available bytes are returned
+    TEST_ASSERT_EQUAL(RingBuffer_DequeueBytes(&RingBuffer, read_bytes, sizeof(read_bytes)), 4);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&bytes[2], read_bytes, 4);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+
+    TEST_ASSERT_EQUAL(RingBuffer_DequeueBytes(&RingBuffer, read_bytes, sizeof(read_bytes)), 0);
+}
+
+void test_DequeueBytesNull(void)
+{
+    Assert_Callback_ExpectAnyArgs();
+    RingBuffer_DequeueBytes(&RingBuffer, NULL, 1);
+}
+
+void test_Peek(void)
+{
+    uint8_t bytes[6] = {1, 2, 3, 4, 5, 6};
+    uint8_t read_bytes[8];
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 12;
+
+    RingBuffer_QueueBytes(&RingBuffer, bytes, sizeof(bytes));
+
+    TEST_ASSERT_EQUAL(RingBuffer_Peek(&RingBuffer, read_bytes, sizeof(read_bytes)), sizeof(bytes));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, read_bytes, sizeof(bytes));
+
+    // Data is not removed
+    TEST_ASSERT_EQUAL(RingBuffer_Peek(&RingBuffer, read_bytes, 3), 3);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, read_bytes, 3);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, 12);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), sizeof(bytes));
+}
+
+void test_GetReadSpans(void)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+
+    TEST_ASSERT_EQUAL(RingBuffer_GetReadSpans(&RingBuffer, spans), 0);
+    TEST_ASSERT_EQUAL(spans[0].len, 0);
+    TEST_ASSERT_EQUAL(spans[1].len, 0);
+
+    RingBuffer.wr = 10;
+    RingBuffer.rd = 4;
+
+    TEST_ASSERT_EQUAL(RingBuffer_GetReadSpans(&RingBuffer, spans), 6);
+    TEST_ASSERT_EQUAL(spans[0].p_buf, &ByteBuffer[4]);
+    TEST_ASSERT_EQUAL(spans[0].len, 6);
+    TEST_ASSERT_EQUAL(spans[1].len, 0);
+
+    RingBuffer.wr = BYTE_BUFFER_LEN + 3;
+    RingBuffer.rd = 12;
+
+    TEST_ASSERT_EQUAL(RingBuffer_GetReadSpans(&RingBuffer, spans), 7);
+    TEST_ASSERT_EQUAL(spans[0].p_buf, &ByteBuffer[12]);
+    TEST_ASSERT_EQUAL(spans[0].len, 4);
+    TEST_ASSERT_EQUAL(spans[1].p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(spans[1].len, 3);
+
+    RingBuffer_IncrementRdIndex(&RingBuffer, 7);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+}
+
+void test_GetReadSpansSkippedTail(void)
+{
+    struct RingBufferSpan spans[RING_BUFFER_SPANS_CNT];
+    struct RingBufferSpan span;
+    uint8_t               read_bytes[8];
+
+    RingBuffer.wr = 12;
+    RingBuffer.rd = 9;
+    memset(ByteBuffer, 0xAA, sizeof(ByteBuffer));
+
+    RingBuffer_ReserveContinuous(&RingBuffer, 6, &span);
+    memset(span.p_buf, 0x55, span.len);
+    RingBuffer_CommitContinuous(&RingBuffer, &span);
+
+    // Skipped tail is in neither of the spans
+    TEST_ASSERT_EQUAL(RingBuffer_GetReadSpans(&RingBuffer, spans), 9);
+    TEST_ASSERT_EQUAL(spans[0].p_buf, &ByteBuffer[9]);
+    TEST_ASSERT_EQUAL(spans[0].len, 3);
+    TEST_ASSERT_EQUAL(spans[1].p_buf, ByteBuffer);
+    TEST_ASSERT_EQUAL(spans[1].len, 6);
+
+    // Read index is moved over the skipped tail
+    TEST_ASSERT_EQUAL(RingBuffer_DequeueBytes(&RingBuffer, read_bytes, 5), 5);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, read_bytes[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x55, read_bytes[3]);
+    TEST_ASSERT_EQUAL(RingBuffer.rd, BYTE_BUFFER_LEN + 2);
+    TEST_ASSERT_EQUAL(RingBuffer_DataLen(&RingBuffer), 4);
+
+    RingBuffer_IncrementRdIndex(&RingBuffer, 4);
+    TEST_ASSERT_EQUAL(RingBuffer_IsEmpty(&RingBuffer), true);
+}
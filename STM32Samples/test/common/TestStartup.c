@@ -0,0 +1,176 @@
+#include "MockAssert.h"
+#include "MockSimpleScheduler.h"
+#include "MockTimestamp.h"
+#include "Startup.c"
+#include "Utils.h"
+#include "unity.h"
+
+static bool ActionPolled(void);
+static bool ActionDone(void);
+static void DoneCallback1(void);
+
+static size_t ActionPolledCallsCnt = 0;
+static size_t ActionPolledDoneCnt  = 0;
+static size_t ActionDoneCallsCnt   = 0;
+static size_t DoneCallbacksCnt     = 0;
+
+static const struct StartupStep StepsDelay[] = {
+    {NULL, 100},
+    {ActionDone, 0},
+};
+
+static const struct StartupStep StepsPolled[] = {
+    {ActionPolled, 100},
+};
+
+static const struct StartupSequence SequenceDelay = {
+    .p_name    = "Delay",
+    .p_steps   = StepsDelay,
+    .steps_cnt = ARRAY_SIZE(StepsDelay),
+};
+
+static const struct StartupSequence SequencePolled = {
+    .p_name    = "Polled",
+    .p_steps   = StepsPolled,
+    .steps_cnt = ARRAY_SIZE(StepsPolled),
+};
+
+static bool ActionPolled(void)
+{
+    ActionPolledCallsCnt++;
+
+    return ActionPolledCallsCnt >= ActionPolledDoneCnt;
+}
+
+static bool ActionDone(void)
+{
+    ActionDoneCallsCnt++;
+
+    return true;
+}
+
+static void DoneCallback1(void)
+{
+    DoneCallbacksCnt++;
+}
+
+static uint32_t Timestamp_GetTimeElapsed_StubCbk(uint32_t timestamp_earlier, uint32_t timestamp_further, int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return timestamp_further - timestamp_earlier;
+}
+
+static void StartAt(uint32_t timestamp)
+{
+    Timestamp_GetCurrent_IgnoreAndReturn(timestamp);
+    SimpleScheduler_TaskAdd_Expect(STARTUP_TASK_PERIOD_MS, Startup_Process, SIMPLE_SCHEDULER_TASK_ID_STARTUP, true);
+
+    Startup_Start(DoneCallback1);
+}
+
+static void ProcessAt(uint32_t timestamp)
+{
+    Timestamp_GetCurrent_IgnoreAndReturn(timestamp);
+
+    Startup_Process();
+}
+
+void setUp(void)
+{
+    SequencesCnt = 0;
+    IsStarted    = false;
+    IsDone       = false;
+
+    ActionPolledCallsCnt = 0;
+    ActionPolledDoneCnt  = 0;
+    ActionDoneCallsCnt   = 0;
+    DoneCallbacksCnt     = 0;
+
+    Timestamp_GetTimeElapsed_StubWithCallback(Timestamp_GetTimeElapsed_StubCbk);
+}
+
+void test_AddSequenceAfterStart(void)
+{
+    StartAt(0);
+
+    Assert_Callback_ExpectAnyArgs();
+    Startup_AddSequence(&SequenceDelay);
+}
+
+void test_StartWithoutSequences(void)
+{
+    StartAt(0);
+
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_STARTUP, false);
+    ProcessAt(0);
+
+    TEST_ASSERT_EQUAL(1, DoneCallbacksCnt);
+    TEST_ASSERT_EQUAL(true, Startup_IsDone());
+}
+
+void test_ProcessDelay(void)
+{
+    Startup_AddSequence(&SequenceDelay);
+    StartAt(0);
+
+    ProcessAt(0);
+    ProcessAt(99);
+
+    TEST_ASSERT_EQUAL(0, ActionDoneCallsCnt);
+    TEST_ASSERT_EQUAL(0, DoneCallbacksCnt);
+    TEST_ASSERT_EQUAL(false, Startup_IsDone());
+
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_STARTUP, false);
+    ProcessAt(100);
+
+    TEST_ASSERT_EQUAL(1, ActionDoneCallsCnt);
+    TEST_ASSERT_EQUAL(1, DoneCallbacksCnt);
+    TEST_ASSERT_EQUAL(100, Sequences[0].done_timestamp);
+    TEST_ASSERT_EQUAL(true, Startup_IsDone());
+}
+
+void test_ProcessPolledAction(void)
+{
+    ActionPolledDoneCnt = 3;
+
+    Startup_AddSequence(&SequencePolled);
+    StartAt(0);
+
+    // Delay starts when the action is done
+    ProcessAt(0);
+    ProcessAt(10);
+    ProcessAt(20);
+    ProcessAt(119);
+
+    TEST_ASSERT_EQUAL(3, ActionPolledCallsCnt);
+    TEST_ASSERT_EQUAL(0, DoneCallbacksCnt);
+
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_STARTUP, false);
+    ProcessAt(120);
+
+    TEST_ASSERT_EQUAL(3, ActionPolledCallsCnt);
+    TEST_ASSERT_EQUAL(1, DoneCallbacksCnt);
+}
+
+void test_ProcessSequencesOverlap(void)
+{
+    ActionPolledDoneCnt = 1;
+
+    Startup_AddSequence(&SequenceDelay);
+    Startup_AddSequence(&SequencePolled);
+    StartAt(0);
+
+    ProcessAt(0);
+    ProcessAt(50);
+
+    TEST_ASSERT_EQUAL(0, DoneCallbacksCnt);
+
+    // Both sequences wait at the same time
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_STARTUP, false);
+    ProcessAt(100);
+
+    TEST_ASSERT_EQUAL(1, ActionDoneCallsCnt);
+    TEST_ASSERT_EQUAL(1, ActionPolledCallsCnt);
+    TEST_ASSERT_EQUAL(1, DoneCallbacksCnt);
+}
@@ -1,10 +1,15 @@
+#include <stdlib.h>
 #include <string.h>
 
 #include "MockAssert.h"
+#include "MockTickHal.h"
 #include "MockUartHal.h"
 #include "UartFrame.c"
 #include "unity.h"
 
+#define BIT_ERRORS_FRAMES_CNT 1000
+#define BIT_ERRORS_INTERVAL 1000    // Average number of bits between bit errors
+
 static uint8_t                  *StubUartFrame    = NULL;
 static size_t                    StubUartFrameCnt = 0;
 static struct UartFrameRxTxFrame RxFrame          = {0};
@@ -12,8 +17,25 @@ static struct UartFrameRxTxFrame RxFrame          = {0};
 static uint8_t *ExpectedFrame    = NULL;
 static size_t   ExpectedFrameLen = 0;
 
+static uint8_t  TxBuffer[2 * UART_FRAME_FRAME_LEN(UART_FRAME_MAX_PAYLOAD_LEN)];
+static uint16_t TxFirstSpanLen = 0;
+
+static enum UartHalTxPriority TxPriority = UART_HAL_TX_PRIORITIES_CNT;
+
+static size_t            HandledFramesCnt = 0;
+static enum UartFrameCmd HandledFramesCmd[4];
+
 void setUp(void)
 {
+    HandledFramesCnt = 0;
+    TxFirstSpanLen   = 0;
+    ResyncLen        = 0;
+    ResyncIdx        = 0;
+
+#if UART_FRAME_READY_TICK_ENABLE
+    TickHal_GetClockTick_IgnoreAndReturn(0);
+#endif
+
     uint8_t uart_frame[6] = {0};
 
     size_t i;
@@ -202,7 +224,7 @@ void test_DecodeProperFrameWithCommandRange1Minimum(void)
 
 void test_DecodeProperFrameWithCommandRange1Maximum(void)
 {
-    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_TIME_GET_RESP, 0x12, 0x32, 0xD0, 0x46};
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_RANGE1_END, 0x12, 0x32, 0x30, 0x47};
 
     CheckFrameDecodingStatus(uart_frame, sizeof(uart_frame), UART_FRAME_STATUS_FRAME_READY);
     CheckValidFrame();
@@ -376,7 +398,7 @@ void test_ProcessIncommingDataProperFrameWithCommandRange1Minimum(void)
 
 void test_ProcessIncommingDataProperFrameWithCommandRange1Maximum(void)
 {
-    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_TIME_GET_RESP, 0x12, 0x32, 0xD0, 0x46};
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_RANGE1_END, 0x12, 0x32, 0x30, 0x47};
 
     CheckFrameProcessingData(uart_frame, sizeof(uart_frame), true);
 
@@ -413,10 +435,513 @@ void test_ProcessIncommingDataProperFrameWithCommandRange2Maximum(void)
     CheckValidFrame();
 }
 
-void StubUartHal_SendBuffer(uint8_t *p_buff, size_t buff_len, int cmock_num_calls)
+static bool RxFrameHandler(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    TEST_ASSERT_TRUE(HandledFramesCnt < ARRAY_SIZE(HandledFramesCmd));
+
+    HandledFramesCmd[HandledFramesCnt] = p_rx_frame->cmd;
+    HandledFramesCnt++;
+
+    return true;
+}
+
+static bool RxFrameStopHandler(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    RxFrameHandler(p_rx_frame);
+
+    return false;
+}
+
+static bool RxFrameCountHandler(struct UartFrameRxTxFrame *p_rx_frame)
+{
+    UNUSED(p_rx_frame);
+
+    HandledFramesCnt++;
+
+    return true;
+}
+
+void CheckFrameProcessingDataBulk(uint8_t *p_buf1, uint16_t buf1_len, uint8_t *p_buf2, uint16_t buf2_len, size_t expected_frames_cnt)
+{
+    uint16_t empty_buf_len = 0;
+
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(p_buf1);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf1_len);
+    UartHal_IncrementRxRdIndex_Expect(buf1_len);
+
+    if (p_buf2 != NULL)
+    {
+        UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(p_buf2);
+        UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf2_len);
+        UartHal_IncrementRxRdIndex_Expect(buf2_len);
+    }
+    else
+    {
+        UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(p_buf1);
+        UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+    }
+
+    size_t frames_cnt = UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameHandler);
+
+    TEST_ASSERT_EQUAL(expected_frames_cnt, frames_cnt);
+    TEST_ASSERT_EQUAL(expected_frames_cnt, HandledFramesCnt);
+}
+
+void test_ProcessIncomingDataBulkNullPtr(void)
+{
+    uint16_t empty_buf_len = 0;
+
+    Assert_Callback_ExpectAnyArgs();
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(NULL);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+
+    UartFrame_ProcessIncomingDataBulk(&RxFrame, NULL);
+}
+
+void test_ProcessIncomingDataBulkEmpty(void)
+{
+    uint16_t empty_buf_len = 0;
+
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(NULL);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+
+    size_t frames_cnt = UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameHandler);
+
+    TEST_ASSERT_EQUAL(0, frames_cnt);
+    TEST_ASSERT_EQUAL(0, HandledFramesCnt);
+}
+
+void test_ProcessIncomingDataBulkMultipleFrames(void)
+{
+    uint8_t rx_buf[] = {0x12,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        0x12,
+                        0x32,
+                        0x9F,
+                        0xC4,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        UART_FRAME_CMD_DFU_CANCEL_RESP,
+                        0x12,
+                        0x32,
+                        0x7B,
+                        0xCE};
+
+    CheckFrameProcessingDataBulk(rx_buf, sizeof(rx_buf), NULL, 0, 3);
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_PING_REQUEST, HandledFramesCmd[0]);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[1]);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_DFU_CANCEL_RESP, HandledFramesCmd[2]);
+    TEST_ASSERT_EQUAL(0x02, RxFrame.len);
+
+    CheckValidFrame();
+}
+
+void test_ProcessIncomingDataBulkFrameSplitBetweenBuffers(void)
+{
+    uint8_t rx_buf1[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_PING_REQUEST, 0x12};
+    uint8_t rx_buf2[] = {0x32, 0x9F, 0xC4, UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x00, 0x17, 0x7F, 0x80};
+
+    CheckFrameProcessingDataBulk(rx_buf1, sizeof(rx_buf1), rx_buf2, sizeof(rx_buf2), 2);
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_PING_REQUEST, HandledFramesCmd[0]);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[1]);
+
+    CheckValidFrame();
+}
+
+void test_ProcessIncomingDataBulkHandlerStop(void)
+{
+    uint8_t rx_buf[] = {0x12,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        0x12,
+                        0x32,
+                        0x9F,
+                        0xC4,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80};
+    uint16_t buf_len       = sizeof(rx_buf);
+    uint16_t first_len     = 9;
+    uint16_t remaining_len = buf_len - first_len;
+
+    // Decoding stops after the first frame, the second one stays in the RX buffer
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf_len);
+    UartHal_IncrementRxRdIndex_Expect(first_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameStopHandler));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_PING_REQUEST, HandledFramesCmd[0]);
+
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(&rx_buf[first_len]);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&remaining_len);
+    UartHal_IncrementRxRdIndex_Expect(remaining_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameStopHandler));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[1]);
+}
+
+void test_ProcessIncomingDataBulkHandlerStopDuringResync(void)
+{
+    // Corrupted frame header - frame length covers the next two frames, which are decoded again from the resync bytes
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x0C,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        0x01,
+                        0x12,
+                        0x34,
+                        0x8B,
+                        0xC4};
+    uint16_t buf_len       = sizeof(rx_buf);
+    uint16_t empty_buf_len = 0;
+
+    // Decoding stops after the first frame, the whole RX buffer is consumed and the second frame is left in the resync bytes
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf_len);
+    UartHal_IncrementRxRdIndex_Expect(buf_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameStopHandler));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[0]);
+    TEST_ASSERT_EQUAL(true, UartFrame_IsRxDataAvailable());
+
+    // No new data is received, the second frame is decoded from the resync bytes
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+    UartHal_IncrementRxRdIndex_Expect(0);
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameHandler));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_PING_REQUEST, HandledFramesCmd[1]);
+
+    UartHal_IsRxDataAvailable_ExpectAndReturn(false);
+    TEST_ASSERT_EQUAL(false, UartFrame_IsRxDataAvailable());
+}
+
+#if UART_FRAME_READY_TICK_ENABLE
+static uint32_t StubTickHal_GetClockTick(int cmock_num_calls)
+{
+    // Clock tick is sampled only when a frame is decoded
+    return 1000 * (cmock_num_calls + 1);
+}
+#endif
+
+void test_ProcessIncomingDataBulkFrameReadyTick(void)
+{
+#if UART_FRAME_READY_TICK_ENABLE
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        0x01,
+                        0x12,
+                        0x34,
+                        0x8B,
+                        0xC4};
+    uint16_t buf_len   = sizeof(rx_buf);
+    uint16_t first_len = 6;
+
+    TickHal_GetClockTick_StubWithCallback(StubTickHal_GetClockTick);
+
+    // Decoding stops after each frame, so the tick is checked before the next frame is decoded
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf_len);
+    UartHal_IncrementRxRdIndex_Expect(first_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameStopHandler));
+    TEST_ASSERT_EQUAL(1000, UartFrame_GetFrameReadyTick());
+
+    buf_len -= first_len;
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(&rx_buf[first_len]);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&buf_len);
+    UartHal_IncrementRxRdIndex_Expect(buf_len);
+
+    TEST_ASSERT_EQUAL(1, UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameStopHandler));
+    TEST_ASSERT_EQUAL(2000, UartFrame_GetFrameReadyTick());
+#endif
+}
+
+void test_ProcessIncomingDataBulkCrcError(void)
+{
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        0x12,
+                        0x32,
+                        0x9F,
+                        0xC5,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80};
+
+    CheckFrameProcessingDataBulk(rx_buf, sizeof(rx_buf), NULL, 0, 1);
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[0]);
+
+    CheckValidFrame();
+}
+
+void test_RxStats(void)
+{
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x02,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        0x12,
+                        0x32,
+                        0x9F,
+                        0xC5,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        0x00,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        UART_FRAME_MAX_PAYLOAD_LEN + 1,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x40,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80};
+
+    struct UartHalRxStats   hal_stats = {
+        .bytes_cnt       = sizeof(rx_buf),
+        .overruns_cnt    = 1,
+        .high_water_mark = 512,
+        .buffer_len      = 512,
+    };
+    struct UartFrameRxStats stats;
+
+    UartHal_ClearRxStats_Expect();
+    UartFrame_ClearRxStats();
+
+    CheckFrameProcessingDataBulk(rx_buf, sizeof(rx_buf), NULL, 0, 1);
+
+    UartHal_GetRxStats_ExpectAnyArgs();
+    UartHal_GetRxStats_ReturnThruPtr_p_stats(&hal_stats);
+    UartFrame_GetRxStats(&stats);
+
+    TEST_ASSERT_EQUAL(sizeof(rx_buf), stats.bytes_cnt);
+    TEST_ASSERT_EQUAL(1, stats.frames_cnt);
+    TEST_ASSERT_EQUAL(1, stats.crc_errors_cnt);
+    TEST_ASSERT_EQUAL(1, stats.preamble_errors_cnt);
+    TEST_ASSERT_EQUAL(1, stats.length_errors_cnt);
+    TEST_ASSERT_EQUAL(1, stats.command_errors_cnt);
+    TEST_ASSERT_EQUAL(1, stats.overruns_cnt);
+    TEST_ASSERT_EQUAL(512, stats.buffer_high_water_mark);
+    TEST_ASSERT_EQUAL(512, stats.buffer_len);
+
+    UartHal_ClearRxStats_Expect();
+    UartFrame_ClearRxStats();
+
+    TEST_ASSERT_EQUAL(0, RxFramesCnt);
+    TEST_ASSERT_EQUAL(0, RxCrcErrorsCnt);
+    TEST_ASSERT_EQUAL(0, RxPreambleErrorsCnt);
+    TEST_ASSERT_EQUAL(0, RxLengthErrorsCnt);
+    TEST_ASSERT_EQUAL(0, RxCommandErrorsCnt);
+}
+
+void test_ProcessIncomingDataResyncPreamble(void)
+{
+    // Frame starts with the second byte, which is decoded again after the preamble error
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x00, 0x17, 0x7F, 0x80};
+    bool    status;
+
+    StubUartFrame    = uart_frame;
+    StubUartFrameCnt = 0;
+
+    size_t i;
+    for (i = 0; i < sizeof(uart_frame) + 1; i++)
+    {
+        UartHal_ReadByte_StubWithCallback(StubUartHal_ReadByte);
+
+        status = UartFrame_ProcessIncomingData(&RxFrame);
+        if (i < sizeof(uart_frame))
+        {
+            TEST_ASSERT_EQUAL(status, false);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(status, true);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, RxFrame.cmd);
+    TEST_ASSERT_EQUAL(sizeof(uart_frame), StubUartFrameCnt);
+}
+
+void test_ProcessIncomingDataBulkResyncFrameInsideInvalidFrame(void)
+{
+    // Corrupted frame header - frame length covers the next frame
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x08,
+                        UART_FRAME_CMD_PING_REQUEST,
+                        UART_FRAME_PREAMBLE_BYTE_1,
+                        UART_FRAME_PREAMBLE_BYTE_2,
+                        0x00,
+                        0x17,
+                        0x7F,
+                        0x80,
+                        0x12,
+                        0x34,
+                        0x56,
+                        0x78};
+
+    CheckFrameProcessingDataBulk(rx_buf, sizeof(rx_buf), NULL, 0, 1);
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, HandledFramesCmd[0]);
+    TEST_ASSERT_EQUAL(1, RxCrcErrorsCnt);
+
+    CheckValidFrame();
+}
+
+void test_ProcessIncomingDataBulkResyncRandomBitErrors(void)
 {
-    TEST_ASSERT_EQUAL(ExpectedFrameLen, buff_len);
-    TEST_ASSERT_TRUE(memcmp(p_buff, ExpectedFrame, ExpectedFrameLen) == 0);
+    static uint8_t rx_buf[BIT_ERRORS_FRAMES_CNT * UART_FRAME_FRAME_LEN(16)];
+    uint16_t       rx_buf_len       = 0;
+    size_t         clean_frames_cnt = 0;
+    size_t         bit_error        = 0;
+
+    srand(1);
+
+    size_t i;
+    for (i = 0; i < BIT_ERRORS_FRAMES_CNT; i++)
+    {
+        uint8_t *p_frame = &rx_buf[rx_buf_len];
+        uint8_t  len     = rand() % 17;
+
+        p_frame[UART_FRAME_PREAMBLE_BYTE_1_OFFSET] = UART_FRAME_PREAMBLE_BYTE_1;
+        p_frame[UART_FRAME_PREAMBLE_BYTE_2_OFFSET] = UART_FRAME_PREAMBLE_BYTE_2;
+        p_frame[UART_FRAME_LEN_OFFSET]             = len;
+        p_frame[UART_FRAME_CMD_OFFSET]             = UART_FRAME_CMD_MESH_MESSAGE_REQUEST;
+
+        size_t j;
+        for (j = 0; j < len; j++)
+        {
+            p_frame[UART_FRAME_PAYLOAD_OFFSET + j] = (uint8_t)rand();
+        }
+
+        uint16_t crc                                = UartFrame_CalculateCrc16(len, UART_FRAME_CMD_MESH_MESSAGE_REQUEST, &p_frame[UART_FRAME_PAYLOAD_OFFSET]);
+        p_frame[UART_FRAME_CRC_BYTE_1_OFFSET(len)] = LOW_BYTE(crc);
+        p_frame[UART_FRAME_CRC_BYTE_2_OFFSET(len)] = HIGH_BYTE(crc);
+
+        rx_buf_len += UART_FRAME_FRAME_LEN(len);
+
+        // Bits are flipped at random intervals, so some frames have no errors and some have more than one
+        bool is_clean = true;
+        while (bit_error < rx_buf_len * 8u)
+        {
+            rx_buf[bit_error / 8] ^= 1 << (bit_error % 8);
+            bit_error += 1 + rand() % (2 * BIT_ERRORS_INTERVAL);
+            is_clean = false;
+        }
+
+        if (is_clean)
+        {
+            clean_frames_cnt++;
+        }
+    }
+
+    uint16_t empty_buf_len = 0;
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&rx_buf_len);
+    UartHal_IncrementRxRdIndex_Expect(rx_buf_len);
+    UartHal_GetRxMaxContinuousBuffer_ExpectAnyArgsAndReturn(rx_buf);
+    UartHal_GetRxMaxContinuousBuffer_ReturnThruPtr_p_buf_len(&empty_buf_len);
+
+    size_t frames_cnt = UartFrame_ProcessIncomingDataBulk(&RxFrame, RxFrameCountHandler);
+
+    // Each bit error costs at most the frame it hits
+    TEST_ASSERT_TRUE(clean_frames_cnt < BIT_ERRORS_FRAMES_CNT);
+    TEST_ASSERT_TRUE(frames_cnt >= clean_frames_cnt);
+}
+
+void test_ProcessIncomingDataBulkIncompleteFrame(void)
+{
+    uint8_t rx_buf[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_PING_REQUEST, 0x12, 0x32, 0x9F};
+
+    CheckFrameProcessingDataBulk(rx_buf, sizeof(rx_buf), NULL, 0, 0);
+
+    uint8_t last_byte = 0xC4;
+    CheckFrameDecodingStatus(&last_byte, sizeof(last_byte), UART_FRAME_STATUS_FRAME_READY);
+}
+
+bool StubUartHal_TxReserve(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation, int cmock_num_calls)
+{
+    // Second half of TxBuffer simulates the end of TX DMA buffer, first half its beginning
+    uint16_t first_span_len = ((TxFirstSpanLen == 0) || (TxFirstSpanLen > len)) ? len : TxFirstSpanLen;
+
+    memset(TxBuffer, 0, sizeof(TxBuffer));
+
+    p_reservation->spans[0].p_buf = TxBuffer + sizeof(TxBuffer) / 2;
+    p_reservation->spans[0].len   = first_span_len;
+    p_reservation->spans[1].p_buf = TxBuffer;
+    p_reservation->spans[1].len   = len - first_span_len;
+    p_reservation->priority       = priority;
+
+    TxPriority = priority;
+
+    UNUSED(cmock_num_calls);
+
+    return true;
+}
+
+bool StubUartHal_TxReserveFull(uint16_t len, enum UartHalTxPriority priority, struct UartHalTxReservation *p_reservation, int cmock_num_calls)
+{
+    UNUSED(len);
+    UNUSED(priority);
+    UNUSED(p_reservation);
+    UNUSED(cmock_num_calls);
+
+    return false;
+}
+
+void StubUartHal_TxCommit(struct UartHalTxReservation *p_reservation, int cmock_num_calls)
+{
+    uint8_t frame[UART_FRAME_FRAME_LEN(UART_FRAME_MAX_PAYLOAD_LEN)];
+
+    TEST_ASSERT_EQUAL(ExpectedFrameLen, p_reservation->spans[0].len + p_reservation->spans[1].len);
+
+    memcpy(frame, p_reservation->spans[0].p_buf, p_reservation->spans[0].len);
+    memcpy(frame + p_reservation->spans[0].len, p_reservation->spans[1].p_buf, p_reservation->spans[1].len);
+
+    TEST_ASSERT_TRUE(memcmp(frame, ExpectedFrame, ExpectedFrameLen) == 0);
 
     UNUSED(cmock_num_calls);
 }
@@ -428,7 +953,8 @@ void test_SendFrameWithZeroLen(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(0x01, NULL, 0);
 }
@@ -446,7 +972,8 @@ void test_SendFrameWithMaxLen(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
@@ -458,7 +985,8 @@ void test_SendFrameWithPayload(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
@@ -471,7 +999,8 @@ void test_SendFrameWithCommandOutOfRange1Error1(void)
     ExpectedFrameLen = sizeof(uart_frame);
 
     Assert_Callback_ExpectAnyArgs();
-    UartHal_SendBuffer_ExpectAnyArgs();
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_ExpectAnyArgs();
     UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, (uint8_t)sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
 
@@ -483,7 +1012,8 @@ void test_SendFrameWithCommandOutOfRange1Error2(void)
     ExpectedFrameLen = sizeof(uart_frame);
 
     Assert_Callback_ExpectAnyArgs();
-    UartHal_SendBuffer_ExpectAnyArgs();
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_ExpectAnyArgs();
     UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, (uint8_t)sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
 
@@ -494,7 +1024,8 @@ void test_SendFrameWithCommandOutOfRange2Error(void)
     ExpectedFrameLen     = sizeof(uart_frame);
 
     Assert_Callback_ExpectAnyArgs();
-    UartHal_SendBuffer_ExpectAnyArgs();
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_ExpectAnyArgs();
     UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, (uint8_t)sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
 
@@ -505,21 +1036,23 @@ void test_SendFrameWithCommandRange1Minimum(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(UART_FRAME_CMD_PING_REQUEST, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
 
 void test_SendFrameWithCommandRange1Maximum(void)
 {
-    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_TIME_GET_RESP, 0x12, 0x32, 0xD0, 0x46};
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, UART_FRAME_CMD_RANGE1_END, 0x12, 0x32, 0x30, 0x47};
 
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
-    UartFrame_Send(UART_FRAME_CMD_TIME_GET_RESP, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
+    UartFrame_Send(UART_FRAME_CMD_RANGE1_END, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
 
 void test_SendFrameWithCommandRange2Minimum(void)
@@ -529,7 +1062,8 @@ void test_SendFrameWithCommandRange2Minimum(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(UART_FRAME_CMD_DFU_INIT_REQ, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
@@ -541,7 +1075,186 @@ void test_SendFrameWithCommandRange2Maximum(void)
     ExpectedFrame    = uart_frame;
     ExpectedFrameLen = sizeof(uart_frame);
 
-    UartHal_SendBuffer_StubWithCallback(StubUartHal_SendBuffer);
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
 
     UartFrame_Send(UART_FRAME_CMD_DFU_CANCEL_RESP, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
 }
+
+void test_SendFrameWrappedAroundTxBuffer(void)
+{
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, 0x02, 0x12, 0x34, 0xB7, 0xC4};
+
+    ExpectedFrame    = uart_frame;
+    ExpectedFrameLen = sizeof(uart_frame);
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
+
+    size_t i;
+    for (i = 1; i < sizeof(uart_frame); i++)
+    {
+        TxFirstSpanLen = i;
+        UartFrame_Send(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN);
+    }
+}
+
+void test_SendFrameTxBufferFull(void)
+{
+    uint8_t payload[] = {0x12, 0x34};
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserveFull);
+    Assert_Callback_ExpectAnyArgs();
+
+    UartFrame_Send(0x02, payload, sizeof(payload));
+}
+
+void test_TrySendFrameWithPayload(void)
+{
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x02, 0x02, 0x12, 0x34, 0xB7, 0xC4};
+
+    ExpectedFrame    = uart_frame;
+    ExpectedFrameLen = sizeof(uart_frame);
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
+
+    TEST_ASSERT_EQUAL(true, UartFrame_TrySend(0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET, sizeof(uart_frame) - UART_FRAME_HEADER_LEN - UART_FRAME_CRC_LEN));
+}
+
+void test_TrySendFrameTxBufferFull(void)
+{
+    uint8_t payload[] = {0x12, 0x34};
+
+    // Frame is not sent and no assert is raised
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserveFull);
+
+    TEST_ASSERT_EQUAL(false, UartFrame_TrySend(0x02, payload, sizeof(payload)));
+}
+
+void test_IsTxSpaceAvailable(void)
+{
+    UartHal_GetTxFreeSpace_ExpectAndReturn(UART_HAL_TX_PRIORITY_NORMAL, 8);
+    TEST_ASSERT_EQUAL(true, UartFrame_IsTxSpaceAvailable(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, 2));
+
+    UartHal_GetTxFreeSpace_ExpectAndReturn(UART_HAL_TX_PRIORITY_NORMAL, 7);
+    TEST_ASSERT_EQUAL(false, UartFrame_IsTxSpaceAvailable(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, 2));
+
+    UartHal_GetTxFreeSpace_ExpectAndReturn(UART_HAL_TX_PRIORITY_HIGH, 6);
+    TEST_ASSERT_EQUAL(true, UartFrame_IsTxSpaceAvailable(UART_FRAME_CMD_PING_REQUEST, 0));
+}
+
+void test_TxStats(void)
+{
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0, 0x01, 0x08, 0x00};
+
+    struct UartFrameTxStats stats;
+
+    ExpectedFrame    = uart_frame;
+    ExpectedFrameLen = sizeof(uart_frame);
+    TxFramesCnt      = 0;
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
+
+    UartFrame_Send(0x01, NULL, 0);
+    UartFrame_Send(0x01, NULL, 0);
+    UartFrame_Send(0x01, NULL, 0);
+
+    UartHal_GetTxDmaTransfersCnt_ExpectAndReturn(1);
+    UartFrame_GetTxStats(&stats);
+
+    TEST_ASSERT_EQUAL(3, stats.frames_cnt);
+    TEST_ASSERT_EQUAL(1, stats.dma_transfers_cnt);
+}
+
+void test_SendTxPriority(void)
+{
+    uint8_t payload[2] = {0};
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+
+    UartHal_TxCommit_ExpectAnyArgs();
+    UartFrame_Send(UART_FRAME_CMD_PONG_RESPONSE, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(UART_HAL_TX_PRIORITY_HIGH, TxPriority);
+
+    UartHal_TxCommit_ExpectAnyArgs();
+    UartFrame_Send(UART_FRAME_CMD_DFU_PAGE_STORE_RESP, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(UART_HAL_TX_PRIORITY_HIGH, TxPriority);
+
+    UartHal_TxCommit_ExpectAnyArgs();
+    UartFrame_Send(UART_FRAME_CMD_SENSOR_UPDATE_REQUEST, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(UART_HAL_TX_PRIORITY_NORMAL, TxPriority);
+
+    UartHal_TxCommit_ExpectAnyArgs();
+    UartFrame_Send(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(UART_HAL_TX_PRIORITY_NORMAL, TxPriority);
+}
+
+void test_SendVFrameWithSegments(void)
+{
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0x04, 0x02, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00};
+
+    uint16_t crc                       = UartFrame_CalculateCrc16(0x04, 0x02, uart_frame + UART_FRAME_PAYLOAD_OFFSET);
+    uart_frame[sizeof(uart_frame) - 2] = LOW_BYTE(crc);
+    uart_frame[sizeof(uart_frame) - 1] = HIGH_BYTE(crc);
+
+    ExpectedFrame    = uart_frame;
+    ExpectedFrameLen = sizeof(uart_frame);
+
+    struct UartFrameSegment segments[] = {
+        {uart_frame + UART_FRAME_PAYLOAD_OFFSET, 1},
+        {NULL, 0},
+        {uart_frame + UART_FRAME_PAYLOAD_OFFSET + 1, 3},
+    };
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
+
+    UartFrame_SendV(0x02, segments, ARRAY_SIZE(segments));
+
+    TxFirstSpanLen = UART_FRAME_PAYLOAD_OFFSET + 2;
+    UartFrame_SendV(0x02, segments, ARRAY_SIZE(segments));
+}
+
+void test_SendVFrameWithoutSegments(void)
+{
+    uint8_t uart_frame[] = {UART_FRAME_PREAMBLE_BYTE_1, UART_FRAME_PREAMBLE_BYTE_2, 0, 0x01, 0x08, 0x00};
+
+    ExpectedFrame    = uart_frame;
+    ExpectedFrameLen = sizeof(uart_frame);
+
+    UartHal_TxReserve_StubWithCallback(StubUartHal_TxReserve);
+    UartHal_TxCommit_StubWithCallback(StubUartHal_TxCommit);
+
+    UartFrame_SendV(0x01, NULL, 0);
+}
+
+void test_SendVFrameTooLong(void)
+{
+    uint8_t payload[UART_FRAME_MAX_PAYLOAD_LEN] = {0};
+
+    struct UartFrameSegment segments[] = {
+        {payload, sizeof(payload)},
+        {payload, 1},
+    };
+
+    Assert_Callback_ExpectAnyArgs();
+    Assert_Callback_ExpectAnyArgs();
+
+    UartFrame_SendV(0x02, segments, ARRAY_SIZE(segments));
+}
+
+void test_TrySendVFrameTooLong(void)
+{
+    uint8_t payload[UART_FRAME_MAX_PAYLOAD_LEN] = {0};
+
+    struct UartFrameSegment segments[] = {
+        {payload, sizeof(payload)},
+        {payload, 1},
+    };
+
+    Assert_Callback_ExpectAnyArgs();
+
+    TEST_ASSERT_FALSE(UartFrame_TrySendV(0x02, segments, ARRAY_SIZE(segments)));
+}
@@ -2,6 +2,9 @@
 
 #include "Mesh.h"
 #include "MockAssert.h"
+#include "MockSimpleScheduler.h"
+#include "MockStartup.h"
+#include "MockTickHal.h"
 #include "MockTimestamp.h"
 #include "MockUartFrame.h"
 #include "UartProtocol.c"
@@ -13,6 +16,12 @@ static void UartMessageHandler3(struct UartFrameRxTxFrame *p_frame);
 static void UartMeshMessageHandler1(struct UartProtocolFrameMeshMessageFrame *p_frame);
 static void UartMeshMessageHandler2(struct UartProtocolFrameMeshMessageFrame *p_frame);
 static void UartMeshMessageHandler3(struct UartProtocolFrameMeshMessageFrame *p_frame);
+static void TxSpaceCallback1(void);
+static void RequestResponseCallback(struct UartFrameRxTxFrame *p_frame);
+static void RequestTimeoutCallback(enum UartFrameCmd cmd, uint8_t instance_index);
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static uint32_t UartFrame_GetFrameReadyTick_StubCbk(int cmock_num_calls);
+#endif
 
 static const uint8_t UartFrameCommandList1[] = {
     UART_FRAME_CMD_ATTENTION_EVENT,
@@ -98,11 +107,38 @@ static uint32_t UartMeshMessageExpetedOpcode3 = 0;
 static struct UartFrameRxTxFrame *RxFrame;
 static size_t                     RxFrameSize = 0;
 
+static size_t TxSpaceCallbacksCnt = 0;
+
+static size_t   UartMessageHandledCnt1 = 0;
+static size_t   RxQueuedFramesCnt      = 0;
+static uint32_t ClockTick              = 0;
+static uint32_t ClockTickStep          = 0;
+static uint32_t HandlerClockTicks      = 0;
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static uint32_t FrameReadyTick = 0;
+#endif
+
+static size_t            RequestResponsesCnt         = 0;
+static size_t            RequestTimeoutsCnt          = 0;
+static enum UartFrameCmd RequestTimeoutCmd           = UART_FRAME_CMD_PING_REQUEST;
+static uint8_t           RequestTimeoutInstanceIndex = 0;
+
+static const struct UartProtocolRequestConfig TimeGetRequestConfig = {
+    .p_response_callback = RequestResponseCallback,
+    .p_timeout_callback  = RequestTimeoutCallback,
+    .response_cmd        = UART_FRAME_CMD_TIME_GET_RESP,
+    .timeout_ms          = 100,
+    .retries_cnt         = 2,
+};
+
 static void UartMessageHandler1(struct UartFrameRxTxFrame *p_frame)
 {
     struct UartFrameRxTxFrame *p_rx_frame = (struct UartFrameRxTxFrame *)p_frame;
 
     UartMessageExpetedCmd1 = p_rx_frame->cmd;
+    UartMessageHandledCnt1++;
+
+    ClockTick += HandlerClockTicks;
 }
 
 static void UartMessageHandler2(struct UartFrameRxTxFrame *p_frame)
@@ -147,6 +183,8 @@ static void UartMeshMessageHandler3(struct UartProtocolFrameMeshMessageFrame *p_
 {
     UartMeshMessageExpetedOpcode3 = p_frame->mesh_opcode;
 
+    ClockTick += HandlerClockTicks;
+
     uint8_t mesh_msg[] = {0x12, 0x34, 0x56};
 
     TEST_ASSERT_EQUAL(p_frame->instance_index, 7);
@@ -155,6 +193,26 @@ static void UartMeshMessageHandler3(struct UartProtocolFrameMeshMessageFrame *p_
     TEST_ASSERT_TRUE(memcmp(p_frame->p_mesh_msg_payload, mesh_msg, p_frame->mesh_msg_len) == 0);
 }
 
+static void TxSpaceCallback1(void)
+{
+    TxSpaceCallbacksCnt++;
+}
+
+static void RequestResponseCallback(struct UartFrameRxTxFrame *p_frame)
+{
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_TIME_GET_RESP, p_frame->cmd);
+
+    RequestResponsesCnt++;
+}
+
+static void RequestTimeoutCallback(enum UartFrameCmd cmd, uint8_t instance_index)
+{
+    RequestTimeoutCmd           = cmd;
+    RequestTimeoutInstanceIndex = instance_index;
+
+    RequestTimeoutsCnt++;
+}
+
 void setUp(void)
 {
     UartMessageExpetedCmd1 = 0;
@@ -166,6 +224,27 @@ void setUp(void)
     UartMeshMessageExpetedOpcode3 = 0;
 
     HandlerConfigCnt = 0;
+    memset(CommandHandlers, 0, sizeof(CommandHandlers));
+    MeshOpcodeIndexCnt = 0;
+
+    UartMessageHandledCnt1 = 0;
+
+    RequestsCnt         = 0;
+    RequestResponsesCnt = 0;
+    RequestTimeoutsCnt  = 0;
+
+    ClockTick         = 0;
+    ClockTickStep     = 0;
+    HandlerClockTicks = 0;
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    HandlerStatsCnt = 0;
+    FrameReadyTick  = 0;
+
+    UartFrame_GetFrameReadyTick_StubWithCallback(UartFrame_GetFrameReadyTick_StubCbk);
+#endif
+
+    TickHal_GetClockTick_IgnoreAndReturn(0);
 }
 
 void test_Init(void)
@@ -174,16 +253,48 @@ void test_Init(void)
 
     TEST_ASSERT_EQUAL(false, UartProtocol_IsInitialized());
 
-    Timestamp_DelayMs_Expect(UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS);
-    Timestamp_DelayMs_Expect(1000 - UART_PROTOCOL_FRAME_TIMEOUT_ELAPSED_MS);
-    UartFrame_IsInitialized_ExpectAndReturn(false);
-    UartFrame_Init_Expect();
+    SimpleScheduler_TaskAdd_Expect(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessIncomingData, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, false);
+    SimpleScheduler_TaskAdd_Expect(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessTxSpace, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, false);
+    SimpleScheduler_TaskAdd_Expect(UART_PROTOCOL_REQUESTS_TASK_PERIOD_MS,
+                                   UartProtocol_ProcessRequests,
+                                   SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS,
+                                   false);
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+    SimpleScheduler_TaskAdd_Expect(UART_PROTOCOL_TASK_PERIOD_MS, UartProtocol_ProcessPendingTx, SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX, true);
+#endif
+    Startup_AddSequence_Expect(&StartupSequence);
 
     UartProtocol_Init();
 
     TEST_ASSERT_EQUAL(true, UartProtocol_IsInitialized());
 }
 
+void test_StartupSequence(void)
+{
+    TEST_ASSERT_EQUAL(1000, StartupSteps[0].delay_ms + StartupSteps[1].delay_ms);
+
+    UartFrame_IsInitialized_ExpectAndReturn(false);
+    UartFrame_Init_Expect();
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+    UartFrame_SetRxDataCallback_Expect(UartProtocol_RxDataEvent);
+#endif
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+    UartFrame_SetTxCoalescing_Expect(true, UART_PROTOCOL_TX_COALESCING_WINDOW_US);
+#endif
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+
+    TEST_ASSERT_EQUAL(true, StartupSteps[1].p_action());
+}
+
+void test_ProcessPendingTx(void)
+{
+#if UART_PROTOCOL_TX_COALESCING_ENABLE
+    UartFrame_ProcessPendingTx_Expect();
+
+    UartProtocol_ProcessPendingTx();
+#endif
+}
+
 void test_IsInitialized(void)
 {
     IsInitialized = false;
@@ -197,8 +308,8 @@ void test_IsInitialized(void)
 
 void test_RegisterMessageHandler(void)
 {
-    struct UartProtocolHandlerConfig config1;
-    struct UartProtocolHandlerConfig config2;
+    struct UartProtocolHandlerConfig config1 = {0};
+    struct UartProtocolHandlerConfig config2 = {0};
 
     UartProtocol_RegisterMessageHandler(&config1);
     UartProtocol_RegisterMessageHandler(&config2);
@@ -211,7 +322,7 @@ void test_RegisterMessageHandler(void)
 
 void test_RegisterMaxMessageHandler(void)
 {
-    struct UartProtocolHandlerConfig config1;
+    struct UartProtocolHandlerConfig config1 = {0};
 
     size_t i;
     for (i = 0; i < UART_PROTOCOL_MAX_NUMBER_OF_HANDLERS; i++)
@@ -223,6 +334,109 @@ void test_RegisterMaxMessageHandler(void)
     UartProtocol_RegisterMessageHandler(&config1);
 }
 
+void test_RegisterMessageHandlerCommandTable(void)
+{
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig2);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig3);
+
+    TEST_ASSERT_EQUAL_HEX16(0x0007, CommandHandlers[UartProtocol_GetCommandIndex(UART_FRAME_CMD_ATTENTION_EVENT)]);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, CommandHandlers[UartProtocol_GetCommandIndex(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST)]);
+    TEST_ASSERT_EQUAL_HEX16(0x0006, CommandHandlers[UartProtocol_GetCommandIndex(UART_FRAME_CMD_START_TEST_REQ)]);
+    TEST_ASSERT_EQUAL_HEX16(0x0004, CommandHandlers[UartProtocol_GetCommandIndex(UART_FRAME_CMD_START_TEST_RESP)]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, CommandHandlers[UartProtocol_GetCommandIndex(UART_FRAME_CMD_PING_REQUEST)]);
+}
+
+void test_RegisterMessageHandlerInvalidCommand(void)
+{
+    static const enum UartFrameCmd command_list[] = {UART_FRAME_CMD_RANGE1_END + 1};
+
+    struct UartProtocolHandlerConfig config = {
+        .p_uart_frame_command_list   = command_list,
+        .uart_frame_command_list_len = ARRAY_SIZE(command_list),
+        .p_uart_message_handler      = UartMessageHandler1,
+    };
+
+    Assert_Callback_ExpectAnyArgs();
+    UartProtocol_RegisterMessageHandler(&config);
+}
+
+void test_RegisterMessageHandlerMeshOpcodeIndex(void)
+{
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig2);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig3);
+
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(UartMeshMessageOpcodeList1) + ARRAY_SIZE(UartMeshMessageOpcodeList2) + ARRAY_SIZE(UartMeshMessageOpcodeList3),
+                      MeshOpcodeIndexCnt);
+
+    size_t i;
+    for (i = 1; i < MeshOpcodeIndexCnt; i++)
+    {
+        TEST_ASSERT_TRUE(MeshOpcodeIndex[i - 1] < MeshOpcodeIndex[i]);
+    }
+
+    // Handlers of the same opcode are kept in the order of registration
+    i = UartProtocol_FindMeshOpcode(0x0056 | (UART_PROTOCOL_MESH_OPCODE_SIZE_2_OCTET_MASK << 8));
+    TEST_ASSERT_EQUAL_HEX32(UART_PROTOCOL_MESH_OPCODE_ENTRY(0x8056, 1), MeshOpcodeIndex[i]);
+    TEST_ASSERT_EQUAL_HEX32(UART_PROTOCOL_MESH_OPCODE_ENTRY(0x8056, 2), MeshOpcodeIndex[i + 1]);
+
+    i = UartProtocol_FindMeshOpcode(0x0A);
+    TEST_ASSERT_EQUAL_HEX32(UART_PROTOCOL_MESH_OPCODE_ENTRY(0x0A, 1), MeshOpcodeIndex[i]);
+
+    // Not registered opcode
+    i = UartProtocol_FindMeshOpcode(0x8057);
+    TEST_ASSERT_TRUE((i == MeshOpcodeIndexCnt) || (UART_PROTOCOL_MESH_OPCODE_ENTRY_OPCODE(MeshOpcodeIndex[i]) != 0x8057));
+}
+
+void test_RegisterMessageHandlerMaxMeshOpcodes(void)
+{
+    static uint32_t opcode_list[UART_PROTOCOL_MAX_NUMBER_OF_MESH_OPCODES / 2];
+
+    struct UartProtocolHandlerConfig config = {
+        .p_mesh_message_opcode_list   = opcode_list,
+        .mesh_message_opcode_list_len = ARRAY_SIZE(opcode_list),
+        .p_mesh_message_handler       = UartMeshMessageHandler1,
+    };
+
+    size_t i;
+    for (i = 0; i < ARRAY_SIZE(opcode_list); i++)
+    {
+        opcode_list[i] = i;
+    }
+
+    UartProtocol_RegisterMessageHandler(&config);
+    UartProtocol_RegisterMessageHandler(&config);
+
+    Assert_Callback_ExpectAnyArgs();
+    UartProtocol_RegisterMessageHandler(&config);
+}
+
+void test_RegisterMessageHandlerInvalidMeshOpcode(void)
+{
+    static const uint32_t opcode_list[] = {UART_PROTOCOL_MESH_OPCODE_MAX + 1};
+
+    struct UartProtocolHandlerConfig config = {
+        .p_mesh_message_opcode_list   = opcode_list,
+        .mesh_message_opcode_list_len = ARRAY_SIZE(opcode_list),
+        .p_mesh_message_handler       = UartMeshMessageHandler1,
+    };
+
+    Assert_Callback_ExpectAnyArgs();
+    UartProtocol_RegisterMessageHandler(&config);
+}
+
+void test_GetCommandIndex(void)
+{
+    TEST_ASSERT_EQUAL(0, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE1_START));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_CMD_RANGE1_CNT - 1, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE1_END));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_CMD_RANGE1_CNT, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE2_START));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_CMD_CNT - 1, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE2_END));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_INVALID_CMD_INDEX, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE1_END + 1));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_INVALID_CMD_INDEX, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE2_START - 1));
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_INVALID_CMD_INDEX, UartProtocol_GetCommandIndex(UART_FRAME_CMD_RANGE2_END + 1));
+}
+
 void test_CheckIfInstanceIndexExist(void)
 {
     uint8_t instance_index;
@@ -292,13 +506,75 @@ void test_CheckIfInstanceIndexExist(void)
     TEST_ASSERT_EQUAL(instance_index, UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN);
 }
 
-bool UartFrame_ProcessIncomingData_StubCbk(struct UartFrameRxTxFrame *p_rx_frame, int cmock_num_calls)
+static void ExpectRxDataCheck(bool is_rx_data_available)
+{
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, false);
+    UartFrame_IsRxDataAvailable_ExpectAndReturn(is_rx_data_available);
+    if (is_rx_data_available)
+    {
+        SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+    }
+#else
+    UNUSED(is_rx_data_available);
+#endif
+}
+
+size_t UartFrame_ProcessIncomingDataBulk_StubCbk(struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler, int cmock_num_calls)
 {
     memcpy(p_rx_frame, RxFrame, RxFrameSize);
 
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    // UartFrame samples the clock tick when the frame is decoded
+    FrameReadyTick = TickHal_GetClockTick();
+#endif
+
+    p_frame_handler(p_rx_frame);
+
     UNUSED(cmock_num_calls);
 
-    return true;
+    return 1;
+}
+
+size_t UartFrame_ProcessIncomingDataBulk_StubQueueCbk(struct UartFrameRxTxFrame *p_rx_frame, UartFrameRxFrameHandler_T p_frame_handler, int cmock_num_calls)
+{
+    size_t frames_cnt = 0;
+
+    while (RxQueuedFramesCnt > 0)
+    {
+        memcpy(p_rx_frame, RxFrame, RxFrameSize);
+
+        RxQueuedFramesCnt--;
+        frames_cnt++;
+
+        if (!p_frame_handler(p_rx_frame))
+        {
+            break;
+        }
+    }
+
+    UNUSED(cmock_num_calls);
+
+    return frames_cnt;
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static uint32_t UartFrame_GetFrameReadyTick_StubCbk(int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return FrameReadyTick;
+}
+#endif
+
+uint32_t TickHal_GetClockTick_StubCbk(int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    // Clock advances with every read and in the message handlers
+    ClockTick += ClockTickStep;
+
+    return ClockTick;
 }
 
 void test_ProcessIncomingDataInstanceIndexMach(void)
@@ -316,7 +592,8 @@ void test_ProcessIncomingDataInstanceIndexMach(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame);
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -343,7 +620,8 @@ void test_ProcessIncomingDataInstanceIndexUnknown(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame);
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -370,7 +648,8 @@ void test_ProcessIncomingDataInstanceIndexNotMach(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame);
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -396,7 +675,8 @@ void test_ProcessIncomingDataUartMessageMatch(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame);
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, UART_FRAME_CMD_SOFTWARE_RESET_REQUEST);
@@ -423,7 +703,8 @@ void test_ProcessIncomingDataTwoUartMessageMatch(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame);
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -435,6 +716,36 @@ void test_ProcessIncomingDataTwoUartMessageMatch(void)
     TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode3, 0);
 }
 
+void test_ProcessIncomingDataUartMessageRange2(void)
+{
+    static const enum UartFrameCmd command_list[] = {UART_FRAME_CMD_DFU_INIT_REQ, UART_FRAME_CMD_DFU_CANCEL_RESP};
+
+    struct UartProtocolHandlerConfig config = {
+        .p_uart_frame_command_list   = command_list,
+        .uart_frame_command_list_len = ARRAY_SIZE(command_list),
+        .p_uart_message_handler      = UartMessageHandler1,
+        .instance_index              = UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN,
+    };
+
+    UartProtocol_RegisterMessageHandler(&config);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig2);
+
+    struct UartFrameRxTxFrame rx_frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_DFU_CANCEL_RESP,
+    };
+
+    RxFrame     = &rx_frame;
+    RxFrameSize = sizeof(rx_frame);
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
+    UartProtocol_ProcessIncomingData();
+
+    TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, UART_FRAME_CMD_DFU_CANCEL_RESP);
+    TEST_ASSERT_EQUAL(UartMessageExpetedCmd2, 0);
+}
+
 void test_ProcessIncomingDataMeshMessageRequestMatch(void)
 {
     UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
@@ -453,7 +764,8 @@ void test_ProcessIncomingDataMeshMessageRequestMatch(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame) + 3;
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -483,7 +795,8 @@ void test_ProcessIncomingDataTwoMeshMessageRequestMatch(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame) + 3;
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -495,6 +808,33 @@ void test_ProcessIncomingDataTwoMeshMessageRequestMatch(void)
     TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode3, 0x0056 | (UART_PROTOCOL_MESH_OPCODE_SIZE_2_OCTET_MASK << 8));
 }
 
+void test_ProcessIncomingDataMeshMessageRequestInstanceIndexNotMatch(void)
+{
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig2);
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig3);
+
+    static struct UartProtocolFrameMeshMessageRequest rx_frame = {
+        .len            = 4 + 3,
+        .cmd            = UART_FRAME_CMD_MESH_MESSAGE_REQUEST,
+        .instance_index = 8,
+        .sub_index      = 0xAB,
+        .mesh_opcode    = 0x00AA | (UART_PROTOCOL_MESH_OPCODE_SIZE_2_OCTET_MASK << 8),
+        .p_data         = {0x12, 0x34, 0x56},
+    };
+
+    RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
+    RxFrameSize = sizeof(rx_frame) + 3;
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
+    UartProtocol_ProcessIncomingData();
+
+    TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode1, 0);
+    TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode2, 0);
+    TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode3, 0);
+}
+
 void test_ProcessIncomingDataMeshMessageRequest1Match1B(void)
 {
     UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
@@ -513,7 +853,8 @@ void test_ProcessIncomingDataMeshMessageRequest1Match1B(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame) + 3;
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -543,7 +884,8 @@ void test_ProcessIncomingDataMeshMessageRequest1Match2(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame) + 3;
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -573,7 +915,8 @@ void test_ProcessIncomingDataMeshMessageRequest1Match3B(void)
     RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
     RxFrameSize = sizeof(rx_frame) + 3;
 
-    UartFrame_ProcessIncomingData_StubWithCallback(UartFrame_ProcessIncomingData_StubCbk);
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
     UartProtocol_ProcessIncomingData();
 
     TEST_ASSERT_EQUAL(UartMessageExpetedCmd1, 0);
@@ -584,3 +927,460 @@ void test_ProcessIncomingDataMeshMessageRequest1Match3B(void)
     TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode2, 0x00AAAA | (UART_PROTOCOL_MESH_OPCODE_SIZE_3_OCTET_MASK << 16));
     TEST_ASSERT_EQUAL(UartMeshMessageExpetedOpcode3, 0);
 }
+
+void test_ProcessIncomingDataRxDataLeft(void)
+{
+    struct UartFrameRxTxFrame rx_frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_PING_REQUEST,
+    };
+
+    RxFrame     = &rx_frame;
+    RxFrameSize = sizeof(rx_frame);
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(true);
+    UartProtocol_ProcessIncomingData();
+}
+
+void test_ProcessIncomingDataRxBudgetExceeded(void)
+{
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+
+    struct UartFrameRxTxFrame rx_frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_SOFTWARE_RESET_REQUEST,
+    };
+
+    RxFrame           = &rx_frame;
+    RxFrameSize       = sizeof(rx_frame);
+    RxQueuedFramesCnt = 4;
+
+    // Budget is exceeded after the second frame, the remaining ones are processed in the next task run
+    HandlerClockTicks = UART_PROTOCOL_RX_BUDGET_CLOCK_TICKS / 2;
+    TickHal_GetClockTick_StubWithCallback(TickHal_GetClockTick_StubCbk);
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubQueueCbk);
+    ExpectRxDataCheck(true);
+    UartProtocol_ProcessIncomingData();
+
+    TEST_ASSERT_EQUAL(2, UartMessageHandledCnt1);
+    TEST_ASSERT_EQUAL(2, RxQueuedFramesCnt);
+}
+
+void test_ProcessIncomingDataRxBudgetNotExceeded(void)
+{
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+
+    struct UartFrameRxTxFrame rx_frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_SOFTWARE_RESET_REQUEST,
+    };
+
+    RxFrame           = &rx_frame;
+    RxFrameSize       = sizeof(rx_frame);
+    RxQueuedFramesCnt = 4;
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubQueueCbk);
+    ExpectRxDataCheck(false);
+    UartProtocol_ProcessIncomingData();
+
+    TEST_ASSERT_EQUAL(4, UartMessageHandledCnt1);
+    TEST_ASSERT_EQUAL(0, RxQueuedFramesCnt);
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void ProcessProfiledFrame(struct UartFrameRxTxFrame *p_rx_frame, size_t rx_frame_size, uint32_t handler_clock_ticks)
+{
+    RxFrame           = p_rx_frame;
+    RxFrameSize       = rx_frame_size;
+    HandlerClockTicks = handler_clock_ticks;
+
+    // Clock advances by 10 ticks with every read, including the one when the frame is decoded, and by the given number of ticks in the handler
+    ClockTickStep = 10;
+    TickHal_GetClockTick_StubWithCallback(TickHal_GetClockTick_StubCbk);
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
+    UartProtocol_ProcessIncomingData();
+}
+#endif
+
+void test_HandlerStatsUartMessage(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig1);
+
+    struct UartFrameRxTxFrame rx_frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_SOFTWARE_RESET_REQUEST,
+    };
+
+    ProcessProfiledFrame(&rx_frame, sizeof(rx_frame), 100);
+    ProcessProfiledFrame(&rx_frame, sizeof(rx_frame), 300);
+
+    struct UartProtocolHandlerStats stats;
+
+    TEST_ASSERT_EQUAL(1, UartProtocol_GetHandlerStatsCnt());
+    TEST_ASSERT_EQUAL(true, UartProtocol_GetHandlerStats(0, &stats));
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, stats.cmd);
+    TEST_ASSERT_EQUAL_HEX32(UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE, stats.mesh_opcode);
+
+    TEST_ASSERT_EQUAL(2, stats.handler.cnt);
+    TEST_ASSERT_EQUAL(110, stats.handler.min);
+    TEST_ASSERT_EQUAL(310, stats.handler.max);
+    TEST_ASSERT_EQUAL(420, stats.handler.sum);
+
+    TEST_ASSERT_EQUAL(2, stats.latency.cnt);
+    TEST_ASSERT_EQUAL(10, stats.latency.min);
+    TEST_ASSERT_EQUAL(10, stats.latency.max);
+    TEST_ASSERT_EQUAL(20, stats.latency.sum);
+#endif
+}
+
+void test_HandlerStatsMeshMessage(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig3);
+
+    static struct UartProtocolFrameMeshMessageRequest rx_frame = {
+        .len            = 4 + 3,
+        .cmd            = UART_FRAME_CMD_MESH_MESSAGE_REQUEST,
+        .instance_index = 7,
+        .sub_index      = 0xAB,
+        .mesh_opcode    = 0x0076 | (UART_PROTOCOL_MESH_OPCODE_SIZE_2_OCTET_MASK << 8),
+        .p_data         = {0x12, 0x34, 0x56},
+    };
+
+    ProcessProfiledFrame((struct UartFrameRxTxFrame *)&rx_frame, sizeof(rx_frame) + 3, 50);
+
+    struct UartProtocolHandlerStats stats;
+
+    TEST_ASSERT_EQUAL(1, UartProtocol_GetHandlerStatsCnt());
+    TEST_ASSERT_EQUAL(true, UartProtocol_GetHandlerStats(0, &stats));
+
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, stats.cmd);
+    TEST_ASSERT_EQUAL_HEX32(0x0076 | (UART_PROTOCOL_MESH_OPCODE_SIZE_2_OCTET_MASK << 8), stats.mesh_opcode);
+    TEST_ASSERT_EQUAL(1, stats.handler.cnt);
+    TEST_ASSERT_EQUAL(60, stats.handler.max);
+    TEST_ASSERT_EQUAL(10, stats.latency.max);
+#endif
+}
+
+void test_HandlerStatsHandlerNotCalled(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    UartProtocol_RegisterMessageHandler(&MessageHandlerConfig2);
+
+    struct UartProtocolFrameClearFaultRequest rx_frame = {
+        .len            = 0,
+        .cmd            = UART_FRAME_CMD_CLEAR_FAULT_REQUEST,
+        .instance_index = 8,
+    };
+
+    ProcessProfiledFrame((struct UartFrameRxTxFrame *)&rx_frame, sizeof(rx_frame), 0);
+
+    TEST_ASSERT_EQUAL(0, UartProtocol_GetHandlerStatsCnt());
+#endif
+}
+
+void test_HandlerStatsMaxEntries(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    size_t i;
+    for (i = 0; i < UART_PROTOCOL_HANDLER_PROFILING_MAX_ENTRIES; i++)
+    {
+        UartProtocol_AddHandlerStats(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, i, 0);
+    }
+
+    // Commands which do not fit are not profiled, the existing entries are still updated
+    UartProtocol_AddHandlerStats(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE, 0);
+    UartProtocol_AddHandlerStats(UART_FRAME_CMD_MESH_MESSAGE_REQUEST, 0, 0);
+
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_HANDLER_PROFILING_MAX_ENTRIES, UartProtocol_GetHandlerStatsCnt());
+    TEST_ASSERT_NULL(UartProtocol_FindHandlerStats(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE));
+    TEST_ASSERT_EQUAL(2, HandlerStats[0].handler.cnt);
+#endif
+}
+
+void test_ClearHandlerStats(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    struct UartProtocolHandlerStats stats;
+
+    UartProtocol_AddHandlerStats(UART_FRAME_CMD_SOFTWARE_RESET_REQUEST, UART_PROTOCOL_HANDLER_STATS_NO_MESH_OPCODE, 0);
+
+    TEST_ASSERT_EQUAL(true, UartProtocol_GetHandlerStats(0, &stats));
+    TEST_ASSERT_EQUAL(false, UartProtocol_GetHandlerStats(1, &stats));
+
+    UartProtocol_ClearHandlerStats();
+
+    TEST_ASSERT_EQUAL(0, UartProtocol_GetHandlerStatsCnt());
+    TEST_ASSERT_EQUAL(false, UartProtocol_GetHandlerStats(0, &stats));
+#endif
+}
+
+void test_RxDataEvent(void)
+{
+#if UART_PROTOCOL_RX_EVENT_ENABLE
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL, true);
+    UartProtocol_RxDataEvent();
+#endif
+}
+
+void test_TrySend(void)
+{
+    uint8_t payload[] = {0x01, 0x02};
+
+    UartFrame_TrySend_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, payload, sizeof(payload), true);
+
+    TEST_ASSERT_EQUAL(true, UartProtocol_TrySend(UART_FRAME_CMD_PING_REQUEST, payload, sizeof(payload)));
+}
+
+void test_TrySendTxBufferFull(void)
+{
+    uint8_t payload[] = {0x01, 0x02};
+
+    UartFrame_TrySend_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, payload, sizeof(payload), false);
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, true);
+
+    TEST_ASSERT_EQUAL(false, UartProtocol_TrySend(UART_FRAME_CMD_PING_REQUEST, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_PING_REQUEST, TxBlockedCmd);
+    TEST_ASSERT_EQUAL(sizeof(payload), TxBlockedLen);
+}
+
+void test_TrySendVTxBufferFull(void)
+{
+    uint8_t                 header[]   = {0x01, 0x02, 0x03};
+    uint8_t                 payload[]  = {0x04, 0x05};
+    struct UartFrameSegment segments[] = {
+        {header, sizeof(header)},
+        {payload, sizeof(payload)},
+    };
+
+    UartFrame_TrySendV_ExpectAndReturn(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, segments, ARRAY_SIZE(segments), false);
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, true);
+
+    TEST_ASSERT_EQUAL(false, UartProtocol_TrySendV(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, segments, ARRAY_SIZE(segments)));
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, TxBlockedCmd);
+    TEST_ASSERT_EQUAL(sizeof(header) + sizeof(payload), TxBlockedLen);
+}
+
+void test_TrySendVPayloadTooLong(void)
+{
+    uint8_t                 payload[UART_FRAME_MAX_PAYLOAD_LEN] = {0};
+    struct UartFrameSegment segments[]                          = {
+        {payload, sizeof(payload)},
+        {payload, 1},
+    };
+
+    // Frame never fits in the TX buffer, so TX space task is not enabled
+    UartFrame_TrySendV_ExpectAndReturn(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, segments, ARRAY_SIZE(segments), false);
+
+    TEST_ASSERT_EQUAL(false, UartProtocol_TrySendV(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, segments, ARRAY_SIZE(segments)));
+}
+
+void test_ProcessTxSpace(void)
+{
+    TxSpaceCallbackCnt = 0;
+    TxSpaceCallbacksCnt = 0;
+
+    UartProtocol_RegisterTxSpaceCallback(TxSpaceCallback1);
+    UartProtocol_RegisterTxSpaceCallback(TxSpaceCallback1);
+
+    TxBlockedCmd = UART_FRAME_CMD_PING_REQUEST;
+    TxBlockedLen = 2;
+
+    // Callbacks are not called until there is enough space for the blocked frame
+    UartFrame_IsTxSpaceAvailable_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, 2, false);
+
+    UartProtocol_ProcessTxSpace();
+    TEST_ASSERT_EQUAL(0, TxSpaceCallbacksCnt);
+
+    UartFrame_IsTxSpaceAvailable_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, 2, true);
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_TX_SPACE, false);
+
+    UartProtocol_ProcessTxSpace();
+    TEST_ASSERT_EQUAL(2, TxSpaceCallbacksCnt);
+}
+
+void test_RegisterMaxTxSpaceCallback(void)
+{
+    TxSpaceCallbackCnt = 0;
+
+    size_t i;
+    for (i = 0; i < UART_PROTOCOL_MAX_NUMBER_OF_TX_SPACE_CALLBACKS; i++)
+    {
+        UartProtocol_RegisterTxSpaceCallback(TxSpaceCallback1);
+    }
+
+    Assert_Callback_ExpectAnyArgs();
+    UartProtocol_RegisterTxSpaceCallback(TxSpaceCallback1);
+}
+
+void test_IsTxSpaceAvailable(void)
+{
+    UartFrame_IsTxSpaceAvailable_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, 2, true);
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsTxSpaceAvailable(UART_FRAME_CMD_PING_REQUEST, 2));
+
+    UartFrame_IsTxSpaceAvailable_ExpectAndReturn(UART_FRAME_CMD_PING_REQUEST, 2, false);
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsTxSpaceAvailable(UART_FRAME_CMD_PING_REQUEST, 2));
+}
+
+static void SendTimeGetRequest(uint8_t instance_index, uint32_t timestamp)
+{
+    Timestamp_GetCurrent_IgnoreAndReturn(timestamp);
+    UartFrame_Send_Expect(UART_FRAME_CMD_TIME_GET_REQ, &instance_index, sizeof(instance_index));
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, true);
+
+    UartProtocol_SendRequest(&TimeGetRequestConfig, UART_FRAME_CMD_TIME_GET_REQ, instance_index, &instance_index, sizeof(instance_index));
+}
+
+static void ReceiveTimeGetResponse(uint8_t instance_index)
+{
+    struct UartProtocolFrameTimeGetResponse rx_frame = {
+        .len            = sizeof(struct UartProtocolFrameTimeGetResponse) - UART_PROTOCOL_FRAME_HEADER_LEN,
+        .cmd            = UART_FRAME_CMD_TIME_GET_RESP,
+        .instance_index = instance_index,
+    };
+
+    RxFrame     = (struct UartFrameRxTxFrame *)&rx_frame;
+    RxFrameSize = sizeof(rx_frame);
+
+    UartFrame_ProcessIncomingDataBulk_StubWithCallback(UartFrame_ProcessIncomingDataBulk_StubCbk);
+    ExpectRxDataCheck(false);
+    UartProtocol_ProcessIncomingData();
+}
+
+static uint32_t Timestamp_GetTimeElapsed_StubCbk(uint32_t timestamp_earlier, uint32_t timestamp_further, int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return timestamp_further - timestamp_earlier;
+}
+
+void test_SendRequestResponse(void)
+{
+    SendTimeGetRequest(3, 0);
+
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 3));
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 4));
+
+    ReceiveTimeGetResponse(3);
+
+    TEST_ASSERT_EQUAL(1, RequestResponsesCnt);
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 3));
+}
+
+void test_SendRequestResponseInstanceIndexNotMatch(void)
+{
+    SendTimeGetRequest(3, 0);
+
+    ReceiveTimeGetResponse(4);
+
+    TEST_ASSERT_EQUAL(0, RequestResponsesCnt);
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 3));
+}
+
+void test_SendRequestResponseOldestFirst(void)
+{
+    SendTimeGetRequest(3, 0);
+    SendTimeGetRequest(4, 0);
+
+    ReceiveTimeGetResponse(UART_PROTOCOL_INSTANCE_INDEX_UNKNOWN);
+
+    TEST_ASSERT_EQUAL(1, RequestResponsesCnt);
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 3));
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 4));
+}
+
+void test_SendSameRequest(void)
+{
+    SendTimeGetRequest(3, 0);
+    SendTimeGetRequest(3, 50);
+
+    TEST_ASSERT_EQUAL(1, RequestsCnt);
+    TEST_ASSERT_EQUAL(50, Requests[0].sent_timestamp);
+
+    SendTimeGetRequest(4, 50);
+
+    TEST_ASSERT_EQUAL(2, RequestsCnt);
+}
+
+void test_SendMaxRequests(void)
+{
+    uint8_t i;
+    for (i = 0; i < UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS; i++)
+    {
+        SendTimeGetRequest(i, 0);
+    }
+
+    TEST_ASSERT_EQUAL(0, RequestTimeoutsCnt);
+
+    // The oldest request is dropped, so the new one is sent even if the modem does not respond
+    SendTimeGetRequest(i, 0);
+
+    TEST_ASSERT_EQUAL(UART_PROTOCOL_MAX_NUMBER_OF_REQUESTS, RequestsCnt);
+    TEST_ASSERT_EQUAL(1, RequestTimeoutsCnt);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_TIME_GET_REQ, RequestTimeoutCmd);
+    TEST_ASSERT_EQUAL(0, RequestTimeoutInstanceIndex);
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 0));
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 1));
+    TEST_ASSERT_EQUAL(true, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, i));
+}
+
+void test_ProcessRequestsTimeout(void)
+{
+    Timestamp_GetTimeElapsed_StubWithCallback(Timestamp_GetTimeElapsed_StubCbk);
+
+    SendTimeGetRequest(3, 0);
+
+    // Timeout not elapsed yet
+    Timestamp_GetCurrent_IgnoreAndReturn(99);
+    UartProtocol_ProcessRequests();
+
+    // First retry, postponed when TX buffer is full
+    Timestamp_GetCurrent_IgnoreAndReturn(100);
+    UartFrame_TrySend_ExpectAndReturn(UART_FRAME_CMD_TIME_GET_REQ, Requests[0].p_payload, 1, false);
+    UartProtocol_ProcessRequests();
+
+    Timestamp_GetCurrent_IgnoreAndReturn(110);
+    UartFrame_TrySend_ExpectAndReturn(UART_FRAME_CMD_TIME_GET_REQ, Requests[0].p_payload, 1, true);
+    UartProtocol_ProcessRequests();
+
+    // Second retry waits twice as long
+    Timestamp_GetCurrent_IgnoreAndReturn(309);
+    UartProtocol_ProcessRequests();
+
+    Timestamp_GetCurrent_IgnoreAndReturn(310);
+    UartFrame_TrySend_ExpectAndReturn(UART_FRAME_CMD_TIME_GET_REQ, Requests[0].p_payload, 1, true);
+    UartProtocol_ProcessRequests();
+
+    TEST_ASSERT_EQUAL(0, RequestTimeoutsCnt);
+
+    // No more retries, request is removed
+    Timestamp_GetCurrent_IgnoreAndReturn(710);
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, false);
+    UartProtocol_ProcessRequests();
+
+    TEST_ASSERT_EQUAL(1, RequestTimeoutsCnt);
+    TEST_ASSERT_EQUAL(UART_FRAME_CMD_TIME_GET_REQ, RequestTimeoutCmd);
+    TEST_ASSERT_EQUAL(3, RequestTimeoutInstanceIndex);
+    TEST_ASSERT_EQUAL(false, UartProtocol_IsRequestPending(UART_FRAME_CMD_TIME_GET_REQ, 3));
+}
+
+void test_ProcessRequestsResponseBeforeTimeout(void)
+{
+    Timestamp_GetTimeElapsed_StubWithCallback(Timestamp_GetTimeElapsed_StubCbk);
+
+    SendTimeGetRequest(3, 0);
+    ReceiveTimeGetResponse(3);
+
+    Timestamp_GetCurrent_IgnoreAndReturn(1000);
+    SimpleScheduler_TaskStateChange_Expect(SIMPLE_SCHEDULER_TASK_ID_UART_PROTOCOL_REQUESTS, false);
+    UartProtocol_ProcessRequests();
+
+    TEST_ASSERT_EQUAL(1, RequestResponsesCnt);
+    TEST_ASSERT_EQUAL(0, RequestTimeoutsCnt);
+}
@@ -27,10 +27,11 @@ uint32_t ExpectedMeshMsqReqOpcode;
 uint8_t ExpectedUartCmdBuf[EXPECTED_RESPONSE_BUF_LEN];
 uint8_t ExpectedUartCmdLen;
 uint8_t ExpectedUartCmdId;
+bool    UartCmdSendResult;
 
 
-static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls);
-static void UartProtocol_SendFrame_StubCbk(struct UartFrameRxTxFrame *p_frame, int cmock_num_calls);
+static bool UartProtocol_TrySend_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls);
+static bool UartProtocol_TrySendV_StubCbk(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt, int cmock_num_calls);
 static void GetElState_Return(enum EmgLTest_ElState el_state);
 static void ExpectMeshMsqReq(uint8_t *buf, uint8_t buf_len, uint32_t opcode);
 static void ExpectUartCmd(uint8_t *buf, uint8_t buf_len, uint8_t cmd_id);
@@ -41,8 +42,9 @@ void setUp(void)
     EmergencyDriverSimulator_IsInitialized_IgnoreAndReturn(false);
     EmergencyDriverSimulator_Init_Ignore();
     UartProtocol_RegisterMessageHandler_Ignore();
-    UartProtocol_SendFrame_StubWithCallback(UartProtocol_SendFrame_StubCbk);
-    UartProtocol_Send_StubWithCallback(UartProtocol_Send_StubCbk);
+    UartProtocol_RegisterTxSpaceCallback_Ignore();
+    UartProtocol_TrySendV_StubWithCallback(UartProtocol_TrySendV_StubCbk);
+    UartProtocol_TrySend_StubWithCallback(UartProtocol_TrySend_StubCbk);
 
     memset(ExpectedMeshMsqReqBuf, 0x00, EXPECTED_RESPONSE_BUF_LEN);
     ExpectedMeshMsqReqLen    = 0;
@@ -51,6 +53,7 @@ void setUp(void)
     memset(ExpectedUartCmdBuf, 0x00, EXPECTED_RESPONSE_BUF_LEN);
     ExpectedUartCmdLen = 0;
     ExpectedUartCmdId  = 0;
+    UartCmdSendResult  = true;
 
     MessageHandlerConfig.instance_index = INSTANCE_INDEX;
 }
@@ -962,7 +965,42 @@ void test_UpdateBatteryStatus(void)
     UpdateBatteryStatus();
 }
 
-static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls)
+void test_UpdateBatteryStatusTxBufferFull(void)
+{
+    IsBatteryStatusPending = false;
+
+    uint8_t expected_cmd       = 0x26;    // BatteryStatusSetRequest
+    uint8_t expected_payload[] = {
+        INSTANCE_INDEX,    // instanceIndex
+        0x64,              // batteryLevel
+        0xFF,              // timeToDischarge
+        0xFF,              // timeToDischarge
+        0xFF,              // timeToDischarge
+        0xFF,              // timeToCharge
+        0xFF,              // timeToCharge
+        0xFF,              // timeToCharge
+        0x5A,              // flags
+    };
+    ExpectUartCmd(expected_payload, sizeof(expected_payload), expected_cmd);
+
+    EmergencyDriverSimulator_QueryBatteryCharge_ExpectAndReturn(254);
+    UartCmdSendResult = false;
+
+    UpdateBatteryStatus();
+    TEST_ASSERT_EQUAL(true, IsBatteryStatusPending);
+
+    // Battery status is sent when there is space in the TX buffer
+    EmergencyDriverSimulator_QueryBatteryCharge_ExpectAndReturn(254);
+    UartCmdSendResult = true;
+
+    UartTxSpaceCallback();
+    TEST_ASSERT_EQUAL(false, IsBatteryStatusPending);
+
+    // Nothing is sent if battery status is not pending
+    UartTxSpaceCallback();
+}
+
+static bool UartProtocol_TrySend_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls)
 {
     UNUSED(cmock_num_calls);
 
@@ -970,13 +1008,27 @@ static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload,
     TEST_ASSERT_EQUAL(ExpectedUartCmdLen, len);
 
     TEST_ASSERT_EQUAL_UINT8_ARRAY(ExpectedUartCmdBuf, p_payload, ExpectedUartCmdLen);
+
+    return UartCmdSendResult;
 }
 
-static void UartProtocol_SendFrame_StubCbk(struct UartFrameRxTxFrame *p_frame, int cmock_num_calls)
+static bool UartProtocol_TrySendV_StubCbk(enum UartFrameCmd cmd, const struct UartFrameSegment *p_segments, size_t segments_cnt, int cmock_num_calls)
 {
     UNUSED(cmock_num_calls);
 
-    struct UartProtocolFrameMeshMessageRequest1Opcode3B *p_response = (struct UartProtocolFrameMeshMessageRequest1Opcode3B *)p_frame;
+    struct UartFrameRxTxFrame frame = {
+        .len = 0,
+        .cmd = cmd,
+    };
+
+    size_t i;
+    for (i = 0; i < segments_cnt; i++)
+    {
+        memcpy(&frame.p_payload[frame.len], p_segments[i].p_data, p_segments[i].len);
+        frame.len += p_segments[i].len;
+    }
+
+    struct UartProtocolFrameMeshMessageRequest1Opcode3B *p_response = (struct UartProtocolFrameMeshMessageRequest1Opcode3B *)&frame;
 
     TEST_ASSERT_EQUAL(5 + ExpectedMeshMsqReqLen, p_response->len);
     TEST_ASSERT_EQUAL(UART_FRAME_CMD_MESH_MESSAGE_REQUEST1, p_response->cmd);
@@ -985,6 +1037,8 @@ static void UartProtocol_SendFrame_StubCbk(struct UartFrameRxTxFrame *p_frame, i
     TEST_ASSERT_EQUAL(ExpectedMeshMsqReqOpcode, p_response->mesh_opcode_be);
 
     TEST_ASSERT_EQUAL_UINT8_ARRAY(ExpectedMeshMsqReqBuf, p_response->p_data, ExpectedMeshMsqReqLen);
+
+    return true;
 }
 
 static void GetElState_Return(enum EmgLTest_ElState el_state)
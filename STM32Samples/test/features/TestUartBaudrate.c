@@ -0,0 +1,371 @@
+#include <string.h>
+
+#include "MockAssert.h"
+#include "MockSimpleScheduler.h"
+#include "MockTimestamp.h"
+#include "MockUartProtocol.h"
+#include "UartBaudrate.c"
+#include "Utils.h"
+#include "unity.h"
+
+#define DEFAULT_BAUDRATE 57600
+#define LOOP_STEP_MS 10
+#define MODEM_FRAMES_LEN 8
+
+// Frame sent by the modem stand-in, received by the MCU only if both sides use the same baud rate
+struct ModemFrame
+{
+    uint32_t                   baudrate;
+    struct UartFrameRxTxFrame frame;
+};
+
+static uint32_t          CurrentTime;
+static uint32_t          McuBaudrate;
+static uint32_t          ModemBaudrate;
+static bool              ModemSupportsBaudrateSet;
+static bool              ModemAcceptsBaudrate;
+static bool              ModemSwitchesBaudrate;
+static bool              ModemSendsPongs;
+static struct ModemFrame ModemFrames[MODEM_FRAMES_LEN];
+static size_t            ModemFramesCnt;
+static size_t            BaudrateSetRequestCnt;
+static size_t            SoftwareResetRequestCnt;
+
+
+static uint32_t Timestamp_GetCurrent_StubCbk(int cmock_num_calls);
+static uint32_t Timestamp_GetTimeElapsed_StubCbk(uint32_t timestamp_start, uint32_t timestamp_end, int cmock_num_calls);
+static void     UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls);
+static void     UartProtocol_SetBaudrate_StubCbk(uint32_t baudrate, int cmock_num_calls);
+static uint32_t UartProtocol_GetBaudrate_StubCbk(int cmock_num_calls);
+static void     ModemSend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len);
+static void     ModemDeliver(void);
+static void     RunFor(uint32_t time_ms);
+
+
+void setUp(void)
+{
+    CurrentTime              = 0;
+    McuBaudrate              = DEFAULT_BAUDRATE;
+    ModemBaudrate            = DEFAULT_BAUDRATE;
+    ModemSupportsBaudrateSet = true;
+    ModemAcceptsBaudrate     = true;
+    ModemSwitchesBaudrate    = true;
+    ModemSendsPongs          = true;
+    ModemFramesCnt           = 0;
+    BaudrateSetRequestCnt    = 0;
+    SoftwareResetRequestCnt  = 0;
+
+    IsInitialized = false;
+    State         = UART_BAUDRATE_STATE_DEFAULT;
+
+    Timestamp_GetCurrent_StubWithCallback(Timestamp_GetCurrent_StubCbk);
+    Timestamp_GetTimeElapsed_StubWithCallback(Timestamp_GetTimeElapsed_StubCbk);
+    UartProtocol_Send_StubWithCallback(UartProtocol_Send_StubCbk);
+    UartProtocol_SetBaudrate_StubWithCallback(UartProtocol_SetBaudrate_StubCbk);
+    UartProtocol_GetBaudrate_StubWithCallback(UartProtocol_GetBaudrate_StubCbk);
+    UartProtocol_IsInitialized_IgnoreAndReturn(true);
+    UartProtocol_RegisterMessageHandler_Ignore();
+    UartProtocol_Flush_Ignore();
+    SimpleScheduler_TaskAdd_Ignore();
+
+    UartBaudrate_Init();
+}
+
+void test_Init(void)
+{
+    TEST_ASSERT_EQUAL(true, UartBaudrate_IsInitialized());
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, DefaultBaudrate);
+}
+
+void test_IsInitialized(void)
+{
+    IsInitialized = false;
+
+    TEST_ASSERT_EQUAL(false, UartBaudrate_IsInitialized());
+
+    IsInitialized = true;
+
+    TEST_ASSERT_EQUAL(true, UartBaudrate_IsInitialized());
+}
+
+void test_NegotiateUnsupportedBaudrate(void)
+{
+    TEST_ASSERT_EQUAL(false, UartBaudrate_Negotiate(9600));
+    TEST_ASSERT_EQUAL(false, UartBaudrate_Negotiate(921600));
+
+    TEST_ASSERT_EQUAL(0, BaudrateSetRequestCnt);
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+}
+
+void test_NegotiateSuccess(void)
+{
+    TEST_ASSERT_EQUAL(true, UartBaudrate_Negotiate(460800));
+    TEST_ASSERT_EQUAL(false, UartBaudrate_Negotiate(230400));
+
+    RunFor(100);
+
+    TEST_ASSERT_EQUAL(1, BaudrateSetRequestCnt);
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(460800, McuBaudrate);
+    TEST_ASSERT_EQUAL(460800, ModemBaudrate);
+
+    RunFor(10000);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(460800, McuBaudrate);
+}
+
+void test_NegotiateRejected(void)
+{
+    ModemAcceptsBaudrate = false;
+
+    TEST_ASSERT_EQUAL(true, UartBaudrate_Negotiate(460800));
+
+    RunFor(100);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, ModemBaudrate);
+}
+
+void test_NegotiateNoResponse(void)
+{
+    ModemSupportsBaudrateSet = false;
+
+    TEST_ASSERT_EQUAL(true, UartBaudrate_Negotiate(460800));
+
+    RunFor(UART_BAUDRATE_RESPONSE_TIMEOUT_MS - LOOP_STEP_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_REQUEST_SENT, UartBaudrate_GetState());
+
+    RunFor(LOOP_STEP_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+}
+
+void test_NegotiateVerificationFailure(void)
+{
+    ModemSwitchesBaudrate = false;
+
+    TEST_ASSERT_EQUAL(true, UartBaudrate_Negotiate(460800));
+
+    RunFor(LOOP_STEP_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_VERIFYING, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(460800, McuBaudrate);
+
+    RunFor(UART_BAUDRATE_VERIFY_TIMEOUT_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+}
+
+void test_KeepaliveLoss(void)
+{
+    TEST_ASSERT_EQUAL(true, UartBaudrate_Negotiate(230400));
+
+    RunFor(100);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(230400, McuBaudrate);
+
+    // Modem still uses the negotiated baud rate, but its pongs are lost
+    ModemSendsPongs = false;
+
+    RunFor(UART_BAUDRATE_KEEPALIVE_TIMEOUT_MS - UART_BAUDRATE_KEEPALIVE_INTERVAL_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+
+    TEST_ASSERT_EQUAL(0, SoftwareResetRequestCnt);
+
+    RunFor(UART_BAUDRATE_KEEPALIVE_INTERVAL_MS);
+
+    // Software reset request is received with the negotiated baud rate, restarted modem sends init event with the default baud rate
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_START_PENDING, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+    TEST_ASSERT_EQUAL(1, SoftwareResetRequestCnt);
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, ModemBaudrate);
+
+    ModemSendsPongs = true;
+
+    RunFor(UART_BAUDRATE_START_DELAY_MS + 100);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_TARGET, McuBaudrate);
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_TARGET, ModemBaudrate);
+}
+
+void test_ModemStart(void)
+{
+    ModemSend(UART_FRAME_CMD_INIT_DEVICE_EVENT, NULL, 0);
+    ModemDeliver();
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_START_PENDING, UartBaudrate_GetState());
+
+    RunFor(UART_BAUDRATE_START_DELAY_MS - LOOP_STEP_MS);
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_START_PENDING, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(0, BaudrateSetRequestCnt);
+
+    RunFor(100);
+
+    TEST_ASSERT_EQUAL(1, BaudrateSetRequestCnt);
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_TARGET, McuBaudrate);
+
+    // Init node event after provisioning is received with the negotiated baud rate
+    ModemSend(UART_FRAME_CMD_INIT_NODE_EVENT, NULL, 0);
+    ModemDeliver();
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_ACTIVE, UartBaudrate_GetState());
+}
+
+void test_ModemStartOldFirmware(void)
+{
+    ModemSupportsBaudrateSet = false;
+
+    ModemSend(UART_FRAME_CMD_INIT_DEVICE_EVENT, NULL, 0);
+    ModemDeliver();
+
+    RunFor(UART_BAUDRATE_START_DELAY_MS + UART_BAUDRATE_RESPONSE_TIMEOUT_MS + 100);
+
+    TEST_ASSERT_EQUAL(1, BaudrateSetRequestCnt);
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+}
+
+void test_UnexpectedResponse(void)
+{
+    struct UartProtocolFrameBaudrateSetResponse response = {
+        .status   = UART_PROTOCOL_BAUDRATE_SET_STATUS_ACCEPTED,
+        .baudrate = 460800,
+    };
+
+    ModemSend(UART_FRAME_CMD_BAUDRATE_SET_RESP, (uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN);
+    ModemDeliver();
+
+    TEST_ASSERT_EQUAL(UART_BAUDRATE_STATE_DEFAULT, UartBaudrate_GetState());
+    TEST_ASSERT_EQUAL(DEFAULT_BAUDRATE, McuBaudrate);
+}
+
+static uint32_t Timestamp_GetCurrent_StubCbk(int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return CurrentTime;
+}
+
+static uint32_t Timestamp_GetTimeElapsed_StubCbk(uint32_t timestamp_start, uint32_t timestamp_end, int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return timestamp_end - timestamp_start;
+}
+
+// Modem stand-in - frames sent while the MCU uses a different baud rate than the modem are lost
+static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    if (cmd == UART_FRAME_CMD_BAUDRATE_SET_REQ)
+    {
+        BaudrateSetRequestCnt++;
+    }
+
+    if ((McuBaudrate != ModemBaudrate) || ((cmd == UART_FRAME_CMD_BAUDRATE_SET_REQ) && !ModemSupportsBaudrateSet))
+    {
+        return;
+    }
+
+    switch (cmd)
+    {
+        case UART_FRAME_CMD_BAUDRATE_SET_REQ:
+        {
+            struct UartProtocolFrameBaudrateSetResponse response;
+
+            TEST_ASSERT_EQUAL(sizeof(uint32_t), len);
+            memcpy(&response.baudrate, p_payload, sizeof(uint32_t));
+            response.status = ModemAcceptsBaudrate ? UART_PROTOCOL_BAUDRATE_SET_STATUS_ACCEPTED : UART_PROTOCOL_BAUDRATE_SET_STATUS_REJECTED;
+
+            ModemSend(UART_FRAME_CMD_BAUDRATE_SET_RESP, (uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN);
+
+            if (ModemAcceptsBaudrate && ModemSwitchesBaudrate)
+            {
+                ModemBaudrate = response.baudrate;
+            }
+            break;
+        }
+
+        case UART_FRAME_CMD_PING_REQUEST:
+            if (ModemSendsPongs)
+            {
+                ModemSend(UART_FRAME_CMD_PONG_RESPONSE, p_payload, len);
+            }
+            break;
+
+        case UART_FRAME_CMD_SOFTWARE_RESET_REQUEST:
+            // Restarted modem uses the default baud rate
+            SoftwareResetRequestCnt++;
+            ModemBaudrate = DEFAULT_BAUDRATE;
+            ModemSend(UART_FRAME_CMD_INIT_DEVICE_EVENT, NULL, 0);
+            break;
+
+        default:
+            TEST_FAIL();
+            break;
+    }
+}
+
+static void UartProtocol_SetBaudrate_StubCbk(uint32_t baudrate, int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    McuBaudrate = baudrate;
+}
+
+static uint32_t UartProtocol_GetBaudrate_StubCbk(int cmock_num_calls)
+{
+    UNUSED(cmock_num_calls);
+
+    return McuBaudrate;
+}
+
+static void ModemSend(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len)
+{
+    TEST_ASSERT_TRUE(ModemFramesCnt < MODEM_FRAMES_LEN);
+
+    struct ModemFrame *p_modem_frame = &ModemFrames[ModemFramesCnt++];
+
+    p_modem_frame->baudrate  = ModemBaudrate;
+    p_modem_frame->frame.len = len;
+    p_modem_frame->frame.cmd = cmd;
+    memcpy(p_modem_frame->frame.p_payload, p_payload, len);
+}
+
+static void ModemDeliver(void)
+{
+    size_t i;
+    for (i = 0; i < ModemFramesCnt; i++)
+    {
+        if (ModemFrames[i].baudrate == McuBaudrate)
+        {
+            UartBaudrate_UartMessageHandler(&ModemFrames[i].frame);
+        }
+    }
+
+    ModemFramesCnt = 0;
+}
+
+static void RunFor(uint32_t time_ms)
+{
+    uint32_t end_time = CurrentTime + time_ms;
+
+    while (CurrentTime < end_time)
+    {
+        CurrentTime += LOOP_STEP_MS;
+        ModemDeliver();
+        UartBaudrate_Loop();
+    }
+}
@@ -0,0 +1,300 @@
+#include <string.h>
+
+#include "MockAssert.h"
+#include "MockUartProtocol.h"
+#include "UartDiagnostic.c"
+#include "Utils.h"
+#include "unity.h"
+
+static struct UartFrameRxStats Stats = {
+    .bytes_cnt              = 0x12345678,
+    .frames_cnt             = 1000,
+    .crc_errors_cnt         = 3,
+    .preamble_errors_cnt    = 4,
+    .length_errors_cnt      = 5,
+    .command_errors_cnt     = 6,
+    .overruns_cnt           = 7,
+    .buffer_high_water_mark = 300,
+    .buffer_len             = 512,
+};
+
+static struct UartFrameTxStats TxStats = {
+    .frames_cnt        = 40,
+    .dma_transfers_cnt = 10,
+};
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static struct UartProtocolHandlerStats HandlerStats = {
+    .cmd         = UART_FRAME_CMD_MESH_MESSAGE_REQUEST,
+    .mesh_opcode = 0x8276,
+    .handler     = {.min = 100, .max = 400, .sum = 1000, .cnt = 4},
+    .latency     = {.min = 20, .max = 90, .sum = 200, .cnt = 4},
+};
+
+static struct UartProtocolHandlerStats ExpectedHandlerStats;
+static uint8_t                         ExpectedHandlerStatsIndex;
+static uint8_t                         ExpectedHandlerStatsCnt;
+#endif
+
+static size_t SentResponsesCnt;
+
+static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls);
+static void CheckRxStatsResponse(uint8_t *p_payload, uint8_t len);
+static void CheckTxStatsResponse(uint8_t *p_payload, uint8_t len);
+static void SendRxStatsRequest(uint8_t clear, uint8_t len);
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void CheckHandlerStatsResponse(uint8_t *p_payload, uint8_t len);
+static void SendHandlerStatsRequest(uint8_t entry_index, uint8_t clear, uint8_t len);
+#endif
+
+void setUp(void)
+{
+    SentResponsesCnt = 0;
+
+    UartProtocol_Send_StubWithCallback(UartProtocol_Send_StubCbk);
+}
+
+void test_Init(void)
+{
+    IsInitialized = false;
+
+    TEST_ASSERT_EQUAL(false, UartDiagnostic_IsInitialized());
+
+    UartProtocol_IsInitialized_ExpectAndReturn(true);
+    UartProtocol_RegisterMessageHandler_ExpectAnyArgs();
+
+    UartDiagnostic_Init();
+
+    TEST_ASSERT_EQUAL(true, UartDiagnostic_IsInitialized());
+}
+
+void test_RxStatsRequest(void)
+{
+    UartProtocol_GetRxStats_ExpectAnyArgs();
+    UartProtocol_GetRxStats_ReturnThruPtr_p_stats(&Stats);
+
+    SendRxStatsRequest(UART_PROTOCOL_RX_STATS_KEEP, 1);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+}
+
+void test_RxStatsRequestClear(void)
+{
+    UartProtocol_GetRxStats_ExpectAnyArgs();
+    UartProtocol_GetRxStats_ReturnThruPtr_p_stats(&Stats);
+    UartProtocol_ClearRxStats_Expect();
+
+    SendRxStatsRequest(UART_PROTOCOL_RX_STATS_CLEAR, 1);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+}
+
+void test_RxStatsRequestInvalidLen(void)
+{
+    SendRxStatsRequest(UART_PROTOCOL_RX_STATS_CLEAR, 0);
+    SendRxStatsRequest(UART_PROTOCOL_RX_STATS_CLEAR, 2);
+
+    TEST_ASSERT_EQUAL(0, SentResponsesCnt);
+}
+
+void test_TxStatsRequest(void)
+{
+    struct UartFrameRxTxFrame frame = {
+        .len = 0,
+        .cmd = UART_FRAME_CMD_TX_STATS_REQ,
+    };
+
+    UartProtocol_GetTxStats_ExpectAnyArgs();
+    UartProtocol_GetTxStats_ReturnThruPtr_p_stats(&TxStats);
+
+    UartDiagnostic_UartMessageHandler(&frame);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+}
+
+void test_TxStatsRequestInvalidLen(void)
+{
+    struct UartFrameRxTxFrame frame = {
+        .len = 1,
+        .cmd = UART_FRAME_CMD_TX_STATS_REQ,
+    };
+
+    UartDiagnostic_UartMessageHandler(&frame);
+
+    TEST_ASSERT_EQUAL(0, SentResponsesCnt);
+}
+
+void test_HandlerStatsRequest(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    ExpectedHandlerStats      = HandlerStats;
+    ExpectedHandlerStatsIndex = 1;
+    ExpectedHandlerStatsCnt   = 2;
+
+    UartProtocol_GetHandlerStatsCnt_ExpectAndReturn(2);
+    UartProtocol_GetHandlerStats_ExpectAndReturn(1, NULL, true);
+    UartProtocol_GetHandlerStats_IgnoreArg_p_stats();
+    UartProtocol_GetHandlerStats_ReturnThruPtr_p_stats(&HandlerStats);
+
+    SendHandlerStatsRequest(1, UART_PROTOCOL_HANDLER_STATS_KEEP, 2);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+#endif
+}
+
+void test_HandlerStatsRequestNoEntry(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    memset(&ExpectedHandlerStats, 0, sizeof(ExpectedHandlerStats));
+    ExpectedHandlerStatsIndex = 2;
+    ExpectedHandlerStatsCnt   = 2;
+
+    UartProtocol_GetHandlerStatsCnt_ExpectAndReturn(2);
+    UartProtocol_GetHandlerStats_ExpectAndReturn(2, NULL, false);
+    UartProtocol_GetHandlerStats_IgnoreArg_p_stats();
+
+    SendHandlerStatsRequest(2, UART_PROTOCOL_HANDLER_STATS_KEEP, 2);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+#endif
+}
+
+void test_HandlerStatsRequestClear(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    ExpectedHandlerStats      = HandlerStats;
+    ExpectedHandlerStatsIndex = 0;
+    ExpectedHandlerStatsCnt   = 1;
+
+    UartProtocol_GetHandlerStatsCnt_ExpectAndReturn(1);
+    UartProtocol_GetHandlerStats_ExpectAndReturn(0, NULL, true);
+    UartProtocol_GetHandlerStats_IgnoreArg_p_stats();
+    UartProtocol_GetHandlerStats_ReturnThruPtr_p_stats(&HandlerStats);
+    UartProtocol_LogHandlerStats_Expect();
+    UartProtocol_ClearHandlerStats_Expect();
+
+    SendHandlerStatsRequest(0, UART_PROTOCOL_HANDLER_STATS_CLEAR, 2);
+
+    TEST_ASSERT_EQUAL(1, SentResponsesCnt);
+#endif
+}
+
+void test_HandlerStatsRequestInvalidLen(void)
+{
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+    SendHandlerStatsRequest(0, UART_PROTOCOL_HANDLER_STATS_KEEP, 1);
+    SendHandlerStatsRequest(0, UART_PROTOCOL_HANDLER_STATS_KEEP, 3);
+
+    TEST_ASSERT_EQUAL(0, SentResponsesCnt);
+#endif
+}
+
+static void UartProtocol_Send_StubCbk(enum UartFrameCmd cmd, uint8_t *p_payload, uint8_t len, int cmock_num_calls)
+{
+    switch (cmd)
+    {
+        case UART_FRAME_CMD_RX_STATS_RESP:
+            CheckRxStatsResponse(p_payload, len);
+            break;
+
+        case UART_FRAME_CMD_TX_STATS_RESP:
+            CheckTxStatsResponse(p_payload, len);
+            break;
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+        case UART_FRAME_CMD_HANDLER_STATS_RESP:
+            CheckHandlerStatsResponse(p_payload, len);
+            break;
+#endif
+
+        default:
+            TEST_FAIL();
+            break;
+    }
+
+    SentResponsesCnt++;
+
+    UNUSED(cmock_num_calls);
+}
+
+static void CheckRxStatsResponse(uint8_t *p_payload, uint8_t len)
+{
+    struct UartProtocolFrameRxStatsResponse response;
+
+    TEST_ASSERT_EQUAL(sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN, len);
+
+    memcpy((uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, p_payload, len);
+
+    TEST_ASSERT_EQUAL(Stats.bytes_cnt, response.bytes_cnt);
+    TEST_ASSERT_EQUAL(Stats.frames_cnt, response.frames_cnt);
+    TEST_ASSERT_EQUAL(Stats.crc_errors_cnt, response.crc_errors_cnt);
+    TEST_ASSERT_EQUAL(Stats.preamble_errors_cnt, response.preamble_errors_cnt);
+    TEST_ASSERT_EQUAL(Stats.length_errors_cnt, response.length_errors_cnt);
+    TEST_ASSERT_EQUAL(Stats.command_errors_cnt, response.command_errors_cnt);
+    TEST_ASSERT_EQUAL(Stats.overruns_cnt, response.overruns_cnt);
+    TEST_ASSERT_EQUAL(Stats.buffer_high_water_mark, response.buffer_high_water_mark);
+    TEST_ASSERT_EQUAL(Stats.buffer_len, response.buffer_len);
+}
+
+static void CheckTxStatsResponse(uint8_t *p_payload, uint8_t len)
+{
+    struct UartProtocolFrameTxStatsResponse response;
+
+    TEST_ASSERT_EQUAL(sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN, len);
+
+    memcpy((uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, p_payload, len);
+
+    TEST_ASSERT_EQUAL(TxStats.frames_cnt, response.frames_cnt);
+    TEST_ASSERT_EQUAL(TxStats.dma_transfers_cnt, response.dma_transfers_cnt);
+}
+
+static void SendRxStatsRequest(uint8_t clear, uint8_t len)
+{
+    struct UartFrameRxTxFrame frame;
+
+    frame.len          = len;
+    frame.cmd          = UART_FRAME_CMD_RX_STATS_REQ;
+    frame.p_payload[0] = clear;
+    frame.p_payload[1] = 0;
+
+    UartDiagnostic_UartMessageHandler(&frame);
+}
+
+#if UART_PROTOCOL_HANDLER_PROFILING_ENABLE
+static void CheckHandlerStatsResponse(uint8_t *p_payload, uint8_t len)
+{
+    struct UartProtocolFrameHandlerStatsResponse response;
+
+    TEST_ASSERT_EQUAL(sizeof(response) - UART_PROTOCOL_FRAME_HEADER_LEN, len);
+
+    memcpy((uint8_t *)&response + UART_PROTOCOL_FRAME_HEADER_LEN, p_payload, len);
+
+    uint32_t handler_mean = (ExpectedHandlerStats.handler.cnt != 0) ? ExpectedHandlerStats.handler.sum / ExpectedHandlerStats.handler.cnt : 0;
+    uint32_t latency_mean = (ExpectedHandlerStats.latency.cnt != 0) ? ExpectedHandlerStats.latency.sum / ExpectedHandlerStats.latency.cnt : 0;
+
+    TEST_ASSERT_EQUAL(ExpectedHandlerStatsIndex, response.entry_index);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStatsCnt, response.entries_cnt);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.cmd, response.handler_cmd);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.mesh_opcode, response.mesh_opcode);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.handler.cnt, response.calls_cnt);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.handler.min, response.handler_min_ticks);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.handler.max, response.handler_max_ticks);
+    TEST_ASSERT_EQUAL(handler_mean, response.handler_mean_ticks);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.latency.min, response.latency_min_ticks);
+    TEST_ASSERT_EQUAL(ExpectedHandlerStats.latency.max, response.latency_max_ticks);
+    TEST_ASSERT_EQUAL(latency_mean, response.latency_mean_ticks);
+}
+
+static void SendHandlerStatsRequest(uint8_t entry_index, uint8_t clear, uint8_t len)
+{
+    struct UartFrameRxTxFrame frame;
+
+    frame.len          = len;
+    frame.cmd          = UART_FRAME_CMD_HANDLER_STATS_REQ;
+    frame.p_payload[0] = entry_index;
+    frame.p_payload[1] = clear;
+    frame.p_payload[2] = 0;
+
+    UartDiagnostic_UartMessageHandler(&frame);
+}
+#endif